@@ -26,6 +26,7 @@ exclude_structs = [
     'CameraFOVStatus',
     'CameraStoredInfo',
     'CameraTrigger',
+    'CollisionQuery',
     'Cutscene',
     'CutsceneSplinePoint',
     'CutsceneVariable',
@@ -34,13 +35,14 @@ exclude_structs = [
     'HandheldShakePoint',
     'LinearTransitionPoint',
     'MarioAnimDmaRelatedThing',
-    'ModAudioSampleCopies',
+    'ModAudioVoice',
     'ModFile',
     'ModeTransitionInfo',
     'OffsetSizePair',
     'PaintingMeshVertex',
     'ParallelTrackingPoint',
     'PlayerGeometry',
+    'RayCache',
     'SPTask',
     'SoundState',
     'TransitionInfo',
@@ -103,8 +103,9 @@ override_allowed_functions = {
 
 override_disallowed_functions = {
     "src/audio/external.h":                     [ " func_" ],
-    "src/engine/surface_load.h":                [ "load_area_terrain", "alloc_surface_pools", "clear_dynamic_surfaces", "get_area_terrain_size" ],
-    "src/engine/surface_collision.h":           [ " debug_", "f32_find_wall_collision" ],
+    "src/engine/surface_load.h":                [ "load_area_terrain", "alloc_surface_pools", "clear_dynamic_surfaces", "get_area_terrain_size", "get_static_surface_slab", "surface_y_index_get_stats", "dynamic_surface_get_stats" ],
+    "src/engine/surface_collision.h":           [ " debug_", "f32_find_wall_collision", "_batch", "_cached", "_worker_queries", "_surfaces_tested", "_region_index" ],
+    "src/engine/math_util.h":                   [ "_scalar", "f_fast" ],
     "src/game/mario_actions_airborne.c":        [ "^[us]32 act_.*" ],
     "src/game/mario_actions_automatic.c":       [ "^[us]32 act_.*" ],
     "src/game/mario_actions_cutscene.c":        [ "^[us]32 act_.*", " geo_", "spawn_obj", "print_displaying_credits_entry" ],
@@ -113,9 +114,10 @@ override_disallowed_functions = {
     "src/game/mario_actions_stationary.c":      [ "^[us]32 act_.*" ],
     "src/game/mario_actions_submerged.c":       [ "^[us]32 act_.*" ],
     "src/game/mario_step.h":                    [ " stub_mario_step", "transfer_bully_speed" ],
-    "src/game/mario.h":                         [ " init_mario" ],
+    "src/game/mario.h":                         [ " init_mario", "_geometry_prefetch" ],
     "src/pc/djui/djui_console.h":               [ " djui_console_create", "djui_console_message_create", "djui_console_message_dequeue" ],
-    "src/pc/djui/djui_chat_message.h":          [ "create_from" ],
+    "src/pc/djui/djui_chat_message.h":          [ "create_from", "create_row", "_bind", "max_text_width" ],
+    "src/pc/djui/djui_hud_utils.h":             [ "_batch" ],
     "src/game/interaction.h":                   [ "process_interaction", "_handle_" ],
     "src/game/sound_init.h":                    [ "_loop_", "thread4_", "set_sound_mode" ],
     "src/pc/network/network_utils.h":           [ "network_get_player_text_color[^_]" ],
@@ -128,19 +130,19 @@ override_disallowed_functions = {
     "src/pc/lua/utils/smlua_obj_utils.h":       [ "spawn_object_remember_field" ],
     "src/game/camera.h":                        [ "update_camera", "init_camera", "stub_camera", "^reset_camera", "move_point_along_spline", "romhack_camera_init_settings", "romhack_camera_reset_settings" ],
     "src/game/behavior_actions.h":              [ "bhv_dust_smoke_loop", "bhv_init_room" ],
-    "src/pc/lua/utils/smlua_audio_utils.h":     [ "smlua_audio_utils_override", "audio_custom_shutdown", "smlua_audio_custom_deinit", "audio_sample_destroy_pending_copies", "audio_custom_update_volume" ],
+    "src/pc/lua/utils/smlua_audio_utils.h":     [ "smlua_audio_utils_override", "audio_custom_shutdown", "smlua_audio_custom_deinit", "audio_custom_update_volume" ],
     "src/pc/lua/utils/smlua_level_utils.h":     [ "smlua_level_util_reset" ],
     "src/pc/lua/utils/smlua_text_utils.h":      [ "smlua_text_utils_init", "smlua_text_utils_shutdown", "smlua_text_utils_dialog_get_unmodified"],
     "src/pc/lua/utils/smlua_anim_utils.h":      [ "smlua_anim_util_reset", "smlua_anim_util_register_animation" ],
     "src/pc/lua/utils/smlua_gfx_utils.h":       [ "gfx_allocate_internal", "vtx_allocate_internal", "gfx_get_length_no_sentinel" ],
-    "src/pc/network/lag_compensation.h":        [ "lag_compensation_clear" ],
+    "src/pc/network/lag_compensation.h":        [ "lag_compensation_clear", "lag_compensation_rewind_ticks", "lag_compensation_get_player_hitbox" ],
     "src/game/first_person_cam.h":              [ "first_person_update" ],
     "src/pc/lua/utils/smlua_collision_utils.h": [ "collision_find_surface_on_ray" ],
-    "src/engine/behavior_script.h":             [ "stub_behavior_script_2", "cur_obj_update" ],
-    "src/pc/mods/mod_storage.h":                [ "mod_storage_shutdown" ],
+    "src/engine/behavior_script.h":             [ "stub_behavior_script_2", "cur_obj_update", "bhv_script_" ],
+    "src/pc/mods/mod_storage.h":                [ "mod_storage_flush", "mod_storage_shutdown" ],
     "src/pc/mods/mod_fs.h":                     [ "mod_fs_read_file_from_uri", "mod_fs_shutdown" ],
     "src/pc/utils/misc.h":                      [ "str_.*", "file_get_line", "delta_interpolate_(normal|rgba|mtx)", "detect_and_skip_mtx_interpolation", "precise_delay_f64" ],
-    "src/engine/lighting_engine.h":             [ "le_calculate_vertex_lighting", "le_clear", "le_shutdown" ],
+    "src/engine/lighting_engine.h":             [ "le_calculate_vertex_lighting", "le_get_tone_mapping", "le_get_gpu_lights", "le_clear", "le_shutdown" ],
 }
 
 override_hide_functions = {
@@ -216,6 +218,11 @@ vec3f_sound_before = """
 manual_index_documentation = """
 - manually written functions
    - [define_custom_obj_fields](#define_custom_obj_fields)
+   - [cobject_fields_compile](#cobject_fields_compile)
+   - [cobject_fields_get](#cobject_fields_get)
+   - [cobject_fields_set](#cobject_fields_set)
+   - [cobject_fields_gather](#cobject_fields_gather)
+   - [cobject_fields_scatter](#cobject_fields_scatter)
    - [network_init_object](#network_init_object)
    - [network_send_object](#network_send_object)
    - [network_send_to](#network_send_to)
@@ -228,6 +235,11 @@ manual_index_documentation = """
    - [log_to_console](#log_to_console)
    - [add_scroll_target](#add_scroll_target)
    - [collision_find_surface_on_ray](#collision_find_surface_on_ray)
+   - [vec3f_new](#vec3f_new)
+   - [collision_find_floors](#collision_find_floors)
+   - [collision_find_ceils](#collision_find_ceils)
+   - [djui_hud_render_rects](#djui_hud_render_rects)
+   - [djui_hud_render_texture_tiles](#djui_hud_render_texture_tiles)
    - [cast_graph_node](#cast_graph_node)
    - [get_uncolored_string](#get_uncolored_string)
    - [gfx_set_command](#gfx_set_command)
@@ -258,6 +270,115 @@ The `fieldTable` table's keys must start with the letter `o` and the values must
 
 [:arrow_up_small:](#)
 
+## [cobject_fields_compile](#cobject_fields_compile)
+
+Resolves the `fields` of `cobject`'s type once and returns a handle for the other `cobject_fields_*` functions, or `nil` when a field doesn't exist. Array and function fields can't be part of a field set. Compile field sets on load and keep the handles, there can be at most 256 of them.
+
+### Lua Example
+`local POS_VEL = cobject_fields_compile(gMarioStates[0].marioObj, { "oPosX", "oPosY", "oPosZ", "oVelY" })`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| cobject | `CObject` |
+| fields | `table` |
+
+### Returns
+- `integer`
+
+### C Prototype
+`N/A`
+
+[:arrow_up_small:](#)
+
+## [cobject_fields_get](#cobject_fields_get)
+
+Reads every field of the field set `handle` from `cobject` in one call, equivalent to indexing each of them. The values are written in order into `out` when given instead of a new table.
+
+### Lua Example
+`local values = cobject_fields_get(o, POS_VEL, values)`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| cobject | `CObject` |
+| handle | `integer` |
+| out | `table` |
+
+### Returns
+- `table`
+
+### C Prototype
+`N/A`
+
+[:arrow_up_small:](#)
+
+## [cobject_fields_set](#cobject_fields_set)
+
+Writes every field of the field set `handle` on `cobject` in one call, equivalent to assigning each of them. `nil` values and immutable fields are left untouched.
+
+### Lua Example
+`cobject_fields_set(o, POS_VEL, { 0, 100, 0, 30 })`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| cobject | `CObject` |
+| handle | `integer` |
+| values | `table` |
+
+### Returns
+- None
+
+### C Prototype
+`N/A`
+
+[:arrow_up_small:](#)
+
+## [cobject_fields_gather](#cobject_fields_gather)
+
+Reads the field set `handle` from each of the `cobjects` in one call. The values are written into `out` when given instead of a new table, the fields of the first object first, then those of the second and so on.
+
+### Lua Example
+`local values = cobject_fields_gather(objects, POS_VEL, values)`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| cobjects | `table` |
+| handle | `integer` |
+| out | `table` |
+
+### Returns
+- `table`
+
+### C Prototype
+`N/A`
+
+[:arrow_up_small:](#)
+
+## [cobject_fields_scatter](#cobject_fields_scatter)
+
+Writes the field set `handle` on each of the `cobjects` in one call, taking the values in the order `cobject_fields_gather` returns them.
+
+### Lua Example
+`cobject_fields_scatter(objects, POS_VEL, values)`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| cobjects | `table` |
+| handle | `integer` |
+| values | `table` |
+
+### Returns
+- None
+
+### C Prototype
+`N/A`
+
+[:arrow_up_small:](#)
+
 ## [network_init_object](#network_init_object)
 
 Enables synchronization on an object.
@@ -548,6 +669,119 @@ Shoots a raycast from `startX`, `startY`, and `startZ` in the direction of `dirX
 
 <br />
 
+## [vec3f_new](#vec3f_new)
+
+Creates a new vector owned by Lua. Pass nothing for a zero vector, up to three components, or another vector to copy it. Vectors support `+`, `-`, `*` and `/` with each other and with numbers, and the `vec3f_*` functions work on them in place without allocating.
+
+### Lua Example
+`local dir = vec3f_normalize(vec3f_new(m.pos) - o.header.gfx.pos)`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| x | `number` |
+| y | `number` |
+| z | `number` |
+
+### Returns
+- [Vec3f](structs.md#Vec3f)
+
+### C Prototype
+`N/A`
+
+[:arrow_up_small:](#)
+
+<br />
+
+## [collision_find_floors](#collision_find_floors)
+
+Finds the highest floor under each of the `positions`, equivalent to calling `find_floor` on each of them but cheaper for many positions. Returns a table with the `height` and `surface` of each floor, in the same order as `positions`.
+
+### Lua Example
+`local floors = collision_find_floors({ gMarioStates[0].pos, gMarioStates[1].pos })`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| positions | `table` |
+
+### Returns
+- `table`
+
+### C Prototype
+`void find_floors_batch(const Vec3f *positions, s32 count, f32 *heights, struct Surface **floors);`
+
+[:arrow_up_small:](#)
+
+<br />
+
+## [collision_find_ceils](#collision_find_ceils)
+
+Finds the lowest ceiling above each of the `positions`, equivalent to calling `find_ceil` on each of them but cheaper for many positions. Returns a table with the `height` and `surface` of each ceiling, in the same order as `positions`.
+
+### Lua Example
+`local ceils = collision_find_ceils({ gMarioStates[0].pos, gMarioStates[1].pos })`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| positions | `table` |
+
+### Returns
+- `table`
+
+### C Prototype
+`void find_ceils_batch(const Vec3f *positions, s32 count, f32 *heights, struct Surface **ceils);`
+
+[:arrow_up_small:](#)
+
+<br />
+
+## [djui_hud_render_rects](#djui_hud_render_rects)
+
+Renders many DJUI HUD rects onto the screen in one call, equivalent to calling `djui_hud_render_rect` for each of them but cheaper. `rects` is a flat table of `x, y, width, height` for every rect.
+
+### Lua Example
+`djui_hud_render_rects({ 0, 0, 32, 32, 64, 0, 32, 32 })`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| rects | `table` |
+
+### Returns
+- None
+
+### C Prototype
+`void djui_hud_render_rect_batch(const f32* rects, u32 count);`
+
+[:arrow_up_small:](#)
+
+<br />
+
+## [djui_hud_render_texture_tiles](#djui_hud_render_texture_tiles)
+
+Renders many tiles of one DJUI HUD texture onto the screen in one call, equivalent to calling `djui_hud_render_texture_tile` for each of them but cheaper. `tiles` is a flat table of `x, y, scaleW, scaleH, tileX, tileY, tileW, tileH` for every tile.
+
+### Lua Example
+`djui_hud_render_texture_tiles(texture, { 0, 0, 1, 1, 0, 0, 16, 16, 32, 0, 1, 1, 16, 0, 16, 16 })`
+
+### Parameters
+| Field | Type |
+| ----- | ---- |
+| texInfo | [TextureInfo](structs.md#TextureInfo) |
+| tiles | `table` |
+
+### Returns
+- None
+
+### C Prototype
+`void djui_hud_render_texture_tile_batch(struct TextureInfo* texInfo, const f32* tiles, u32 count);`
+
+[:arrow_up_small:](#)
+
+<br />
+
 ## [set_exclamation_box_contents](#set_exclamation_box_contents)
 
 Sets the contents that the exclamation box spawns. A single content has 5 keys: `id`, `unused`, `firstByte`, `model`, and `behavior`.
@@ -776,12 +1010,23 @@ def build_vec_types():
 
         # Get
         s += "void smlua_get_%s(%s dest, int index) {\n" % (type_name.lower(), type_name)
+        s += "    void *src = smlua_get_vec_pointer(gLuaState, index, LOT_%s);\n" % (type_name.upper())
+        s += "    if (src) {\n"
+        s += "        memcpy(dest, src, sizeof(%s));\n" % (type_name)
+        s += "        gSmLuaConvertSuccess = true;\n"
+        s += "        return;\n"
+        s += "    }\n"
         for lua_field, c_field in vec_type["fields_mapping"].items():
             s += "    dest%s = smlua_get_%s_field(index, \"%s\");\n" % (c_field, vec_type["field_lua_type"], lua_field)
         s += "}\n\n"
 
         # Push
         s += "void smlua_push_%s(%s src, int index) {\n" % (type_name.lower(), type_name)
+        s += "    void *dest = smlua_get_vec_pointer(gLuaState, index, LOT_%s);\n" % (type_name.upper())
+        s += "    if (dest) {\n"
+        s += "        memcpy(dest, src, sizeof(%s));\n" % (type_name)
+        s += "        return;\n"
+        s += "    }\n"
         for lua_field, c_field in vec_type["fields_mapping"].items():
             s += "    smlua_push_%s_field(index, \"%s\", src%s);\n" % (vec_type["field_lua_type"], lua_field, c_field)
         for lua_field, c_field in vec_type.get('optional_fields_mapping', {}).items():
@@ -94,13 +94,13 @@ override_field_invisible = {
     "GraphNodeRoot": ["unk15", "views"],
     "GraphNodeMasterList": [ "listHeads", "listTails" ],
     "FnGraphNode": [ "luaTokenIndex" ],
-    "Object": [ "firstSurface" ],
+    "Object": [ "firstSurface", "bhvIndexPrev", "bhvIndexNext", "bhvIndexBehavior" ],
     "Animation": [ "unusedBoneCount" ],
-    "ModAudio": [ "sound", "decoder", "buffer", "bufferSize", "sampleCopiesTail" ],
+    "ModAudio": [ "sound", "decoder", "buffer", "bufferSize", "bufferMapped", "pcm", "pcmFrames", "pcmChannels", "pcmSampleRate" ],
     "Painting": [ "normalDisplayList", "textureMaps", "rippleDisplayList", "ripples" ],
     "DialogEntry": [ "str" ],
-    "ModFsFile": [ "data", "capacity" ],
-    "ModFs": [ "files" ],
+    "ModFsFile": [ "data", "capacity", "entryIndex", "lastUsed", "isMapped", "isChecked", "detectTextMode" ],
+    "ModFs": [ "files", "archive" ],
 }
 
 override_field_deprecated = {
@@ -14,7 +14,7 @@ bool smlua_call_event_hooks_{hook_type}({parameters}) {{
     if (L == NULL) {{ return false; }}{define_hook_result}
 
     struct LuaHookedEvent *hook = &sHookedEvents[{hook_type}];
-    for (int i = 0; i < hook->count; i++) {{{check_mod_index}
+    for (int i = 0; i < hook->count; i++) {{{check_mod_index}{check_filter}
         s32 prevTop = lua_gettop(L);
 
         // push the callback onto the stack
@@ -29,7 +29,7 @@ SMLUA_CALL_EVENT_HOOKS_SET_HOOK_RESULT = """
 
 SMLUA_CALL_EVENT_HOOKS_CALLBACK = """
         // call the callback
-        if (0 != smlua_call_hook(L, {n_inputs}, {n_outputs}, 0, hook->mod[i], hook->modFile[i])) {{
+        if (0 != smlua_call_hook(L, {n_inputs}, {n_outputs}, 0, hook->mod[i], hook->modFile[i], sLuaHookedEventTypeName[{hook_type}])) {{
             LOG_LUA("Failed to call the callback for hook %s", sLuaHookedEventTypeName[{hook_type}]);
             continue;
         }}{set_hook_result}
@@ -52,6 +52,9 @@ SMLUA_CALL_EVENT_HOOKS_END = """
 SMLUA_CALL_EVENT_HOOKS_MOD_INDEX_CHECK = """
         if (hook->mod[i]->index != modIndex) { continue; }"""
 
+SMLUA_CALL_EVENT_HOOKS_FILTER_CHECK = """
+        if (hook->filter[i].flags && smlua_hook_filter_rejects(&hook->filter[i], {mario}, {obj}, {interact})) {{ continue; }}"""
+
 SMLUA_INTEGER_TYPES = {
 "input": """
         // push {name}
@@ -292,10 +295,23 @@ def main():
                 mod_index_found = True
                 break
 
+        # filters look at the first mario, object and interaction type the hook is given
+        filter_mario = next((input["name"] for input in hook_event["inputs"] if input["type"] == "structMarioState*"), None)
+        filter_obj = next((input["name"] for input in hook_event["inputs"] if input["type"] == "structObject*"), None)
+        filter_interact = next((input["name"] for input in hook_event["inputs"] if input["name"] == "interactType"), None)
+        check_filter = ""
+        if filter_mario or filter_obj:
+            check_filter = SMLUA_CALL_EVENT_HOOKS_FILTER_CHECK.format(
+                mario=filter_mario or "NULL",
+                obj=filter_obj or "NULL",
+                interact=filter_interact or "0"
+            )
+
         generated += SMLUA_CALL_EVENT_HOOKS_BEGIN.format(
             hook_type=hook_event["type"],
             parameters=hook_event["parameters"],
             check_mod_index=SMLUA_CALL_EVENT_HOOKS_MOD_INDEX_CHECK if mod_index_found else "",
+            check_filter=check_filter,
             define_hook_result=define_hook_result
         )
 
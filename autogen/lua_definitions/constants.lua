@@ -4837,6 +4837,9 @@ OBJ_FLAG_PERSISTENT_RESPAWN = (1 << 14)
 --- @type integer
 OBJ_FLAG_8000 = (1 << 15)
 
+--- @type integer
+OBJ_FLAG_UPDATE_LOD = (1 << 16)
+
 --- @type integer
 OBJ_FLAG_30 = (1 << 30)
 
@@ -6589,6 +6592,15 @@ TIME_STOP_ACTIVE = (1 << 6)
 --- @type integer
 OBJECT_POOL_CAPACITY = 1200
 
+--- @type integer
+OBJECT_POOL_SLAB_CAPACITY = 600
+
+--- @type integer
+OBJECT_POOL_MAX_SLABS = 6
+
+--- @type integer
+OBJECT_POOL_MAX_CAPACITY = (OBJECT_POOL_CAPACITY + OBJECT_POOL_SLAB_CAPACITY * OBJECT_POOL_MAX_SLABS)
+
 OBJ_LIST_PLAYER      =  0 --- @type ObjectList
 OBJ_LIST_EXT         =  1 --- @type ObjectList
 OBJ_LIST_DESTRUCTIVE =  2 --- @type ObjectList
@@ -4103,6 +4103,31 @@ function djui_hud_render_line(p1X, p1Y, p2X, p2Y, size)
     -- ...
 end
 
+--- @param width integer
+--- @param height integer
+--- @return TextureInfo
+--- Creates an offscreen framebuffer of `width` by `height` pixels, both powers of two, or returns nil if the renderer can't make one. It's drawn like any texture with `djui_hud_render_texture`
+function djui_hud_create_framebuffer(width, height)
+    -- ...
+end
+
+--- @param texInfo TextureInfo
+--- Destroys a framebuffer created with `djui_hud_create_framebuffer`
+function djui_hud_destroy_framebuffer(texInfo)
+    -- ...
+end
+
+--- @param texInfo TextureInfo
+--- Draws the DJUI HUD into the framebuffer `texInfo` instead of the screen, as if it were the whole screen scaled to its size. It's cleared the first time it's drawn into each frame, and can't be drawn from while it's set
+function djui_hud_set_framebuffer(texInfo)
+    -- ...
+end
+
+--- Draws the DJUI HUD onto the screen again after `djui_hud_set_framebuffer`
+function djui_hud_reset_framebuffer()
+    -- ...
+end
+
 --- @return number
 --- Gets the current camera FOV
 function get_current_fov()
@@ -4912,7 +4937,7 @@ end
 
 --- @param otherNp NetworkPlayer
 --- @return MarioState
---- Gets the local Mario's state stored in lag compensation history
+--- Gets the local Mario's state stored in lag compensation history. Only the position, velocity, yaw, action, timers, flags and hitbox are from the past, the other fields are current
 function lag_compensation_get_local_state(otherNp)
     -- ...
 end
@@ -133,8 +133,9 @@ end
 
 --- @param hookEventType LuaHookedEventType When a function should run
 --- @param func fun(...: any): any The function to run
+--- @param filter? table Only run `func` when the hook's Mario or object matches, any of `{ action = integer, playerIndex = integer, behavior = BehaviorId }`
 --- Different hooks can pass in different parameters and have different return values. Be sure to read the hooks guide for more information.
-function hook_event(hookEventType, func)
+function hook_event(hookEventType, func, filter)
     -- ...
 end
 
@@ -247,6 +248,48 @@ function define_custom_obj_fields(objFieldTable)
     -- ...
 end
 
+--- @param cobject CObject The object whose type the fields belong to
+--- @param fields string[] The names of the fields
+--- @return integer?
+--- Resolves the `fields` of `cobject`'s type once and returns a handle for the other `cobject_fields_*` functions, or `nil` when a field doesn't exist. Array and function fields can't be part of a field set
+function cobject_fields_compile(cobject, fields)
+    -- ...
+end
+
+--- @param cobject CObject
+--- @param handle integer A handle from `cobject_fields_compile`
+--- @param out? table A table to reuse for the values
+--- @return table
+--- Reads every field of the field set `handle` from `cobject` in one call, equivalent to indexing each of them
+function cobject_fields_get(cobject, handle, out)
+    -- ...
+end
+
+--- @param cobject CObject
+--- @param handle integer A handle from `cobject_fields_compile`
+--- @param values table The value of every field, `nil` leaves one untouched
+--- Writes every field of the field set `handle` on `cobject` in one call, equivalent to assigning each of them
+function cobject_fields_set(cobject, handle, values)
+    -- ...
+end
+
+--- @param cobjects CObject[]
+--- @param handle integer A handle from `cobject_fields_compile`
+--- @param out? table A table to reuse for the values
+--- @return table
+--- Reads the field set `handle` from each of the `cobjects` in one call, the fields of the first object first, then those of the second and so on
+function cobject_fields_gather(cobjects, handle, out)
+    -- ...
+end
+
+--- @param cobjects CObject[]
+--- @param handle integer A handle from `cobject_fields_compile`
+--- @param values table The values in the order `cobject_fields_gather` returns them
+--- Writes the field set `handle` on each of the `cobjects` in one call
+function cobject_fields_scatter(cobjects, handle, values)
+    -- ...
+end
+
 --- @param object Object Object to sync
 --- @param standardSync boolean Automatically syncs common fields and syncs with distance. If `false`, all syncing must be done with `network_send_object`
 --- @param fieldTable table<string> The fields to sync
@@ -362,13 +405,49 @@ end
 --- @param dirX number Direction X
 --- @param dirY number Direction Y
 --- @param dirZ number Direction Z
---- @param precision? number Optional; How precise the raycast should be. The default value is 3.0, the higher the number, the more precise.
+--- @param precision? number Optional; No longer used, every cell the raycast crosses is checked exactly once. Kept for compatibility
 --- @return RayIntersectionInfo
 --- Shoots a raycast from `startX`, `startY`, and `startZ` in the direction of `dirX`, `dirY`, and `dirZ`
 function collision_find_surface_on_ray(startX, startY, startZ, dirX, dirY, dirZ, precision)
     -- ...
 end
 
+--- @param x? number
+--- @param y? number
+--- @param z? number
+--- @return Vec3f
+--- Creates a new vector owned by Lua. Pass nothing for a zero vector, up to three components, or another vector to copy it. Vectors support `+`, `-`, `*` and `/` with each other and with numbers, and the `vec3f_*` functions work on them in place without allocating
+function vec3f_new(x, y, z)
+    -- ...
+end
+
+--- @param positions Vec3f[] The positions to check
+--- @return { height: number, surface: Surface? }[]
+--- Finds the highest floor under each of the `positions`, equivalent to calling `find_floor` on each of them but cheaper for many positions. Returns a table with the `height` and `surface` of each floor, in the same order as `positions`
+function collision_find_floors(positions)
+    -- ...
+end
+
+--- @param positions Vec3f[] The positions to check
+--- @return { height: number, surface: Surface? }[]
+--- Finds the lowest ceiling above each of the `positions`, equivalent to calling `find_ceil` on each of them but cheaper for many positions. Returns a table with the `height` and `surface` of each ceiling, in the same order as `positions`
+function collision_find_ceils(positions)
+    -- ...
+end
+
+--- @param rects number[] `x, y, width, height` of every rect
+--- Renders many DJUI HUD rects onto the screen in one call, equivalent to calling `djui_hud_render_rect` for each of them but cheaper
+function djui_hud_render_rects(rects)
+    -- ...
+end
+
+--- @param texInfo TextureInfo
+--- @param tiles number[] `x, y, scaleW, scaleH, tileX, tileY, tileW, tileH` of every tile
+--- Renders many tiles of one DJUI HUD texture onto the screen in one call, equivalent to calling `djui_hud_render_texture_tile` for each of them but cheaper
+function djui_hud_render_texture_tiles(texInfo, tiles)
+    -- ...
+end
+
 --- @param contents ExclamationBoxContent[]
 --- Sets the contents that the exclamation box spawns.
 --- A single content has 5 keys: `id`, `unused`, `firstByte`, `model`, and `behavior`
@@ -0,0 +1 @@
+0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x10,0x85,0x20,0x85,0x10,0x85,0x10,0x85,0x10,0x85,0x31,0x09,0x21,0x05,0x10,0x85,0x10,0x01,0x00,0x05,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,0x10,0x81,0x10,0x85,0x10,0x85,0x10,0x85,0x10,0x85,0x20,0x85,0x21,0x09,0x20,0x85,0x31,0x09,0x21,0x09,0x20,0x85,0x20,0x85,0x21,0x09,0x42,0x0d,0x62,0x91,0x62,0x95,0x62,0x8d,0x62,0x91,0x52,0x0d,0x41,0x8d,0x31,0x05,0x20,0x85,0x10,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x21,0x09,0x31,0x8d,0x42,0x0d,0x31,0x8d,0x21,0x05,0x31,0x09,0x31,0x09,0x31,0x0d,0x31,0x0d,0x21,0x0d,0x10,0x89,0x21,0x0d,0x21,0x0d,0x20,0x85,0x00,0x05,0x10,0x85,0x00,0x05,0x10,0x85,0x00,0x01,0x20,0x85,0x10,0x85,0x21,0x89,0x41,0x09,0x32,0x0d,0x41,0x89,0x52,0x0d,0x52,0x09,0x41,0x89,0x20,0x85,0x20,0x85,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x20,0x89,0x42,0x91,0x73,0x19,0x63,0x15,0x62,0x95,0x52,0x91,0x31,0x0d,0x21,0x05,0x10,0x85,0x10,0x01,0x10,0x05,0x10,0x05,0x10,0x05,0x00,0x81,0x00,0x01,0x10,0x05,0x20,0x05,0x10,0x05,0x00,0x01,0x10,0x85,0x00,0x81,0x00,0x05,0x00,0x01,0x00,0x01,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x81,0x00,0x01,0x21,0x05,0x20,0x85,0x21,0x05,0x41,0x09,0x41,0x09,0x21,0x05,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x52,0x95,0xc6,0x31,0xc5,0x29,0x83,0x99,0x51,0x8d,0x51,0x91,0x31,0x05,0x10,0x85,0x10,0x85,0x20,0x81,0x10,0x05,0x20,0x01,0x10,0x01,0x10,0x01,0x10,0x85,0x20,0x05,0x30,0x05,0x41,0x09,0x20,0x01,0x10,0x01,0x10,0x01,0x10,0x05,0x40,0x85,0x20,0x85,0x20,0x05,0x10,0x01,0x00,0x01,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x10,0x85,0x00,0x01,0x20,0x85,0x51,0x89,0x62,0x11,0x41,0x09,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x42,0x11,0x94,0xa1,0xc5,0xa5,0xe5,0xad,0xb4,0x25,0xd3,0xa5,0x92,0x9d,0x51,0x0d,0x20,0x81,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x20,0x01,0x10,0x05,0x20,0x01,0x30,0x05,0x40,0x89,0x91,0x11,0x50,0x85,0x10,0x01,0x20,0x05,0x20,0x81,0x30,0x05,0x20,0x05,0x20,0x01,0x10,0x01,0x20,0x01,0x10,0x01,0x20,0x01,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x20,0x81,0x10,0x81,0x10,0x85,0x10,0x81,0x10,0x01,0x10,0x85,0x41,0x05,0x62,0x11,0x71,0x91,0x41,0x0d,0x00,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x31,0x09,0xa5,0x29,0xfe,0xb5,0xfd,0x2d,0xf4,0xad,0xfe,0xbf,0xff,0x3f,0xff,0x3f,0xd4,0x2d,0x81,0x95,0x20,0x85,0x10,0x01,0x10,0x01,0x00,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x20,0x05,0x20,0x01,0x10,0x05,0x20,0x85,0x40,0x05,0x10,0x85,0x10,0x01,0x10,0x01,0x10,0x85,0x30,0x05,0x20,0x85,0x10,0x01,0x20,0x01,0x10,0x01,0x10,0x01,0x20,0x01,0x20,0x05,0x20,0x81,0x00,0x01,0x10,0x05,0x31,0x01,0x31,0x05,0x42,0x05,0x62,0x09,0x31,0x01,0x10,0x85,0x31,0x85,0x62,0x11,0x73,0x15,0x62,0x0d,0x72,0x15,0x31,0x09,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x51,0x8d,0xc4,0x25,0xfc,0xad,0xfc,0xb1,0xfb,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x92,0xa1,0x20,0x01,0x00,0x05,0x10,0x01,0x10,0x81,0x10,0x01,0x00,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x01,0x10,0x05,0x10,0x01,0x00,0x01,0x10,0x05,0x10,0x05,0x10,0x01,0x00,0x81,0x00,0x05,0x00,0x01,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x00,0x01,0x10,0x81,0x10,0x01,0x51,0x8d,0xd5,0xa1,0xa4,0x15,0x73,0x0d,0x62,0x05,0x72,0x89,0x83,0x91,0x63,0x09,0x83,0x91,0xb5,0x19,0x83,0x15,0x42,0x0d,0xa3,0x1d,0x72,0x15,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x72,0x99,0xf3,0xad,0xfc,0x25,0xfe,0x25,0xff,0x25,0xff,0xbd,0xff,0xff,0xff,0xff,0xd5,0x39,0x72,0x99,0x30,0x89,0x41,0x0d,0x72,0x19,0x51,0x0d,0x82,0x9d,0x41,0x09,0x20,0x05,0x00,0x01,0x10,0x01,0x20,0x81,0x00,0x05,0x10,0x01,0x00,0x01,0x00,0x85,0x10,0x05,0x20,0x05,0x00,0x81,0x00,0x05,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x21,0x01,0x31,0x85,0x41,0x85,0x93,0x91,0xa4,0x95,0xa4,0x95,0xb5,0x19,0xf6,0xa5,0xff,0xe9,0xff,0x29,0x83,0x0d,0x94,0x8d,0x94,0x8d,0x41,0x09,0x31,0x09,0x92,0x99,0x82,0x11,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x82,0x15,0xfc,0x2d,0xfc,0xb5,0xff,0xf1,0xff,0xf9,0xff,0x3f,0xff,0x3f,0x93,0x21,0x51,0x11,0x10,0x85,0x10,0x01,0x41,0x0d,0xfd,0xbf,0xff,0xff,0xff,0x3f,0xfe,0xbf,0xfd,0xb9,0x71,0x0d,0x62,0x15,0x41,0x0d,0x21,0x05,0x10,0x01,0x10,0x85,0x40,0x8d,0x41,0x95,0x21,0x11,0x21,0x0d,0x10,0x89,0x10,0x05,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x81,0x41,0x85,0x51,0x85,0x62,0x09,0x83,0x8d,0xc5,0x99,0xff,0xa9,0xd6,0x21,0xb5,0x19,0xff,0xe5,0xff,0xa9,0xf6,0xa5,0xa4,0x11,0x73,0x8d,0x31,0x85,0x10,0x81,0x42,0x11,0xd4,0x21,0xa3,0x15,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x92,0x15,0xfb,0xb1,0xfc,0x31,0xff,0xff,0xff,0xff,0xfe,0xbf,0xfd,0x3f,0xe5,0x35,0xb4,0x25,0x93,0xa5,0x62,0x19,0x30,0x85,0xb3,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xbf,0xfd,0xb9,0xc3,0xa5,0x31,0x09,0x20,0x01,0x10,0x85,0x21,0x05,0x31,0x0d,0x31,0x09,0x21,0x09,0x10,0x89,0x10,0x81,0x10,0x05,0x10,0x85,0x00,0x01,0x00,0x01,0x10,0x85,0x00,0x01,0x10,0x85,0x00,0x01,0x00,0x01,0x31,0x01,0x41,0x89,0x52,0x85,0xa4,0x15,0xff,0xad,0xff,0xed,0xff,0xe9,0xff,0xa5,0xf7,0x21,0xff,0xed,0xff,0xed,0xe6,0x19,0x42,0x89,0x21,0x05,0x00,0x05,0x10,0x81,0x62,0x95,0xd4,0x21,0x82,0x91,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x61,0x91,0xfb,0xad,0xfc,0xbd,0xfe,0x3f,0xff,0xbf,0xfd,0x3f,0xfd,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xe5,0x35,0xf4,0x31,0xfd,0xbd,0xff,0xff,0xff,0xfd,0xfe,0x99,0xfe,0x31,0xfd,0x3d,0xf3,0x25,0x81,0x8d,0x94,0x19,0x73,0x19,0x83,0x99,0xa5,0x25,0x63,0x19,0x31,0x09,0x21,0x05,0x21,0x05,0x10,0x01,0x42,0x0d,0x52,0x0d,0x42,0x0d,0x10,0x85,0x00,0x01,0x10,0x01,0x10,0x85,0x31,0x89,0x31,0x05,0x62,0x8d,0xb5,0x15,0x84,0x0d,0x83,0x89,0x73,0x0d,0xb4,0x95,0xff,0xa9,0xff,0xe5,0xff,0xe5,0xff,0xf5,0xff,0xed,0xff,0xe5,0xa5,0x19,0x20,0x85,0x21,0x05,0x00,0x81,0x10,0x05,0x52,0x0d,0xd4,0x29,0x41,0x8d,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x20,0x85,0xc2,0x1d,0xfc,0xbd,0xff,0x3f,0xfe,0x3d,0xfe,0x21,0xfe,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xfc,0xbd,0xfc,0xbf,0xff,0xff,0xff,0xf9,0xff,0xe5,0xff,0xbd,0xfc,0x31,0xf2,0x9d,0xf3,0x1d,0xff,0xff,0xf7,0xb5,0xe6,0x31,0xc6,0x2d,0x84,0x21,0x21,0x05,0x21,0x09,0x30,0x85,0x62,0x95,0xa5,0x21,0x83,0x99,0x32,0x09,0x10,0x85,0x30,0x85,0x40,0x85,0x31,0x09,0x84,0x1d,0xa3,0x95,0x41,0x89,0x62,0x89,0x42,0x85,0x41,0x85,0x32,0x09,0x21,0x05,0x42,0x05,0xc5,0x9d,0xff,0xe9,0xff,0xf5,0xff,0xff,0xff,0xf9,0xff,0xed,0x73,0x11,0x72,0x11,0x61,0x0d,0x10,0x85,0x20,0x85,0x83,0x1d,0xb3,0x21,0x00,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x51,0x0d,0xf2,0x1d,0xfd,0x3f,0xfe,0xbf,0xfd,0x3d,0xfd,0x3d,0xff,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xbf,0xfc,0x31,0xfe,0xad,0xff,0x3f,0xff,0xff,0xff,0xbf,0xfc,0xbf,0xfa,0xa5,0xfb,0x25,0xfd,0xbd,0xfe,0xbf,0xe6,0xb1,0xb5,0x25,0xe6,0xb5,0x73,0x9d,0x21,0x05,0x10,0x85,0x10,0x85,0x73,0x15,0x83,0x95,0x73,0x11,0x31,0x09,0x62,0x91,0x52,0x0d,0x51,0x0d,0x10,0x81,0x41,0x8d,0x51,0x8d,0x11,0x05,0x00,0x05,0x00,0x01,0x00,0x01,0x21,0x05,0x51,0x0d,0x72,0x0d,0x62,0x8d,0xff,0x25,0xff,0xf1,0xff,0xfd,0xff,0xfd,0xff,0xf1,0xc5,0x9d,0xa3,0x11,0x72,0x11,0x10,0x05,0x10,0x85,0x21,0x05,0xa3,0x21,0x30,0x8d,0x00,0x01,0x00,0x01,0x10,0x05,0x91,0x0d,0xfa,0x9d,0xfb,0xb5,0xfc,0xb9,0xfc,0xbd,0xe4,0xb5,0xff,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xbf,0xfc,0xb9,0xfd,0xb5,0xfd,0x3d,0xff,0x3f,0xff,0x3f,0xfe,0xbf,0xfb,0xb5,0xfb,0x31,0xfd,0xbf,0xf3,0x29,0x92,0x15,0x51,0x89,0x31,0x8d,0x21,0x05,0x00,0x01,0x10,0x05,0x31,0x0d,0xb3,0x15,0xfd,0x1d,0xfd,0x21,0xe4,0x25,0xf5,0x29,0xfe,0xb5,0xfe,0x39,0x82,0x99,0x41,0x89,0x52,0x0d,0x21,0x09,0x10,0x01,0x00,0x85,0x00,0x01,0x20,0x85,0x61,0x91,0x82,0x11,0xa4,0x0d,0xd6,0x19,0xff,0xed,0xff,0xf5,0xff,0xf9,0xff,0xf5,0xff,0xa5,0xf6,0x99,0x93,0x91,0x11,0x05,0x10,0x01,0x10,0x85,0x51,0x0d,0x41,0x0d,0x00,0x01,0x00,0x01,0x10,0x05,0xb1,0x91,0xfb,0xa5,0xd3,0x25,0x51,0x11,0x61,0x91,0x31,0x0d,0x93,0x21,0x94,0x2d,0x63,0xa5,0x73,0xa9,0xb4,0xb1,0x72,0xa1,0x51,0x91,0xa2,0xa1,0xa2,0x21,0xd3,0xa9,0xc3,0x29,0xfc,0xb5,0xfd,0xbf,0xfb,0x2d,0xfa,0x19,0xe1,0x91,0xe1,0x99,0xd1,0x9d,0x82,0x11,0x31,0x09,0x10,0x85,0x10,0x05,0x00,0x85,0x20,0x89,0x71,0x11,0xc2,0x99,0xc2,0x99,0xc2,0xa1,0xfc,0xb1,0xfe,0xb5,0xfd,0xb5,0x62,0x11,0x00,0x01,0x10,0x85,0x20,0x85,0x10,0x85,0x11,0x05,0x30,0x89,0x41,0x0d,0x52,0x0d,0xd5,0x21,0xff,0xf1,0xff,0xf1,0xff,0xf9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0xff,0xf9,0x82,0x91,0x41,0x8d,0x10,0x89,0x41,0x05,0x20,0x85,0x00,0x01,0x00,0x01,0x10,0x05,0xa1,0x0d,0xfc,0x2d,0xa3,0x25,0x10,0x01,0x10,0x85,0x10,0x05,0x20,0x89,0x20,0x89,0x32,0x15,0x20,0x89,0x30,0x89,0x10,0x89,0x10,0x85,0x10,0x85,0x20,0x89,0x10,0x05,0x20,0x89,0x82,0x19,0xfe,0x3f,0xfc,0x35,0xfa,0x99,0xe1,0x91,0xf1,0x9d,0xf2,0x21,0xc2,0x21,0x41,0x09,0x20,0x09,0x00,0x81,0x10,0x05,0x10,0x01,0x10,0x05,0x62,0x09,0x82,0x89,0x62,0x0d,0x41,0x09,0x51,0x8d,0x41,0x8d,0x20,0x85,0x10,0x01,0x00,0x81,0x31,0x0d,0x21,0x05,0x41,0x0d,0xb3,0x1d,0xff,0xbf,0xfe,0xb9,0xfe,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0xb1,0xa3,0x1d,0x11,0x05,0x41,0x09,0x10,0x05,0x00,0x01,0x00,0x01,0x10,0x05,0x90,0x89,0xfa,0xa5,0x92,0x9d,0x21,0x09,0x10,0x89,0x10,0x85,0x20,0x89,0x51,0x11,0x41,0x91,0x62,0x11,0x51,0x11,0x31,0x09,0x20,0x89,0x10,0x89,0x21,0x11,0x11,0x09,0x10,0x05,0x20,0x85,0x62,0x11,0xfc,0xb1,0xfd,0x3d,0xf4,0x31,0xc2,0xa1,0x92,0x15,0x81,0x91,0x51,0x91,0x30,0x89,0x10,0x85,0x40,0x85,0x40,0x85,0x31,0x8d,0x93,0x19,0x83,0x8d,0x62,0x0d,0x21,0x05,0x20,0x85,0x20,0x85,0x00,0x81,0x10,0x01,0x10,0x89,0x52,0x0d,0x42,0x91,0x82,0x95,0xff,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa3,0xa1,0x20,0x85,0x20,0x85,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x70,0x91,0xfa,0xa5,0x92,0x19,0x10,0x89,0x21,0x0d,0x20,0x8d,0x41,0x0d,0x72,0x15,0x73,0x9d,0x73,0x19,0x63,0x19,0x62,0x1d,0x51,0x95,0x21,0x0d,0x20,0x8d,0x21,0x09,0x00,0x05,0x10,0x85,0x73,0x15,0xb5,0x1d,0xb4,0x9d,0x62,0x91,0x41,0x8d,0x61,0x8d,0x51,0x8d,0x31,0x09,0x31,0x0d,0x41,0x09,0x51,0x8d,0x82,0x8d,0xa4,0x21,0xc5,0x25,0x63,0x95,0x73,0x15,0x31,0x89,0x41,0x09,0x21,0x05,0x10,0x85,0x00,0x01,0x10,0x85,0x41,0x89,0x83,0x99,0xa4,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb3,0x9d,0x31,0x0d,0x20,0x81,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x40,0x8d,0xfb,0xb1,0xf4,0x31,0x31,0x0d,0x10,0x85,0x10,0x89,0x41,0x11,0x63,0x21,0x62,0x9d,0x42,0x99,0x42,0x1d,0x63,0xa5,0x52,0xa1,0x62,0xa5,0x52,0x19,0x21,0x0d,0x10,0x89,0x31,0x91,0x73,0x21,0xa4,0xa1,0xb5,0xa5,0x73,0x15,0x42,0x11,0x72,0x11,0x72,0x91,0x72,0x95,0x52,0x9d,0x41,0x0d,0x31,0x89,0x62,0x15,0xd6,0x2d,0xf6,0xb5,0xc5,0xa5,0x94,0x99,0x31,0x8d,0x41,0x89,0x41,0x8d,0x31,0x89,0x31,0x89,0x41,0x09,0x61,0x0d,0x93,0x9d,0xff,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0x62,0x11,0x10,0x85,0x20,0x85,0x00,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x05,0xa2,0xa1,0xfd,0x39,0x82,0x95,0x10,0x81,0x20,0x89,0x42,0x19,0x52,0xa1,0x63,0x29,0x43,0x21,0x31,0x99,0x43,0x25,0x53,0x21,0x63,0x29,0x62,0xa5,0x52,0x19,0x31,0x99,0x52,0x9d,0x53,0x25,0x52,0xa1,0xb5,0x25,0xa4,0xa1,0x62,0x99,0x72,0x95,0x62,0x11,0x52,0x99,0x42,0x15,0x31,0x8d,0x20,0x85,0x62,0x11,0xd5,0x2d,0xfd,0xa9,0xb4,0x1d,0x83,0x15,0x52,0x91,0x52,0x11,0x84,0x9d,0x62,0x95,0x52,0x11,0x41,0x8d,0x62,0x99,0xe5,0xb9,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x73,0x15,0x30,0x89,0x10,0x81,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x30,0x89,0x92,0x9d,0xb3,0x9d,0x62,0x91,0x21,0x09,0x31,0x0d,0x51,0x9d,0x53,0x25,0x63,0x25,0x52,0xa1,0x53,0x1d,0x52,0x9d,0x32,0x19,0x52,0xa1,0x42,0xa1,0x53,0x29,0x63,0x25,0x63,0xad,0x74,0x31,0xa5,0x2d,0x84,0x19,0x62,0x91,0x52,0x8d,0x41,0x09,0x42,0x15,0xa5,0x2d,0x62,0x99,0x52,0x11,0x51,0x91,0xe3,0xa9,0xfb,0xa5,0xc3,0xa5,0xe4,0x2d,0xb3,0xa5,0x72,0x15,0x93,0x99,0x84,0x1d,0xa4,0x25,0x72,0x9d,0xa5,0x31,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xa5,0x25,0x31,0x09,0x10,0x85,0x10,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x31,0x09,0x51,0x0d,0x83,0x11,0x94,0x99,0x42,0x15,0x31,0x11,0x51,0x99,0x53,0x25,0x42,0xa1,0x41,0x95,0x42,0x15,0x53,0x21,0x73,0xad,0x84,0xb1,0x84,0x35,0x85,0x35,0x94,0xb5,0x95,0x39,0xd6,0x3f,0xfe,0xbd,0xfe,0xbd,0xd4,0xa9,0x83,0x19,0x94,0x2d,0x94,0xa5,0x93,0x9d,0xa3,0xa1,0xc3,0xa5,0xc3,0xa5,0xc3,0xa5,0xc4,0xb1,0xff,0x3f,0xff,0xff,0xff,0xbf,0xfd,0xb9,0xf5,0x35,0xfd,0x3f,0xe6,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x84,0x21,0x31,0x09,0x21,0x05,0x31,0x09,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x41,0x09,0x73,0x15,0x94,0x1d,0x63,0x21,0x52,0xa5,0x52,0xa1,0x42,0xa1,0x52,0xa5,0x63,0xa9,0xc6,0xbf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x84,0x21,0xb3,0xad,0xfe,0x3d,0xfd,0xbf,0xfe,0xbf,0xfe,0xbf,0xff,0xbf,0xff,0xff,0xe7,0xff,0xe7,0xff,0xe7,0xff,0xd7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xb7,0xff,0xa7,0xff,0xa7,0xff,0x97,0xff,0xa7,0xff,0xb7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x83,0x1d,0x30,0x85,0x11,0x05,0x31,0x09,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x05,0x31,0x05,0x42,0x0d,0x83,0x9d,0x73,0xa1,0x52,0x9d,0x42,0x9d,0x74,0x35,0x63,0xad,0xa5,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0x3f,0xff,0xff,0xe7,0xff,0xe7,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xb7,0xff,0x97,0xff,0xa7,0xff,0x97,0xff,0x87,0xbf,0x87,0xbf,0x77,0x3f,0x77,0x3f,0x76,0xbf,0x67,0x3f,0x87,0x3f,0x97,0xff,0xd7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x93,0xa5,0x51,0x91,0x20,0x81,0x20,0x85,0x20,0x85,0x00,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x30,0x89,0x41,0x8d,0x62,0x91,0x73,0x99,0x94,0x29,0x84,0xb5,0x74,0x2d,0x73,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0x97,0xff,0x97,0xbf,0x87,0x3f,0x87,0xbf,0x76,0xbf,0x77,0x3f,0x86,0xbf,0x76,0xbf,0x66,0xbf,0x77,0x3f,0x77,0xbf,0xa7,0xff,0xc7,0xff,0xff,0xff,0xf7,0xff,0xc6,0xbf,0xa5,0x2d,0x62,0x95,0x41,0x91,0x31,0x05,0x21,0x05,0x20,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x10,0x85,0x51,0x8d,0x72,0x95,0x84,0x21,0x83,0xa1,0x84,0xa1,0xb4,0xad,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xc7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0x97,0xbf,0x87,0x3f,0x86,0xbf,0x76,0xbf,0x77,0x3f,0x87,0xbf,0x87,0xbf,0x97,0xff,0xd7,0xff,0xe7,0xff,0xe6,0xbf,0xd5,0xb9,0x83,0x1d,0x52,0x91,0x31,0x8d,0x72,0x91,0x52,0x91,0x20,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x05,0x20,0x85,0x41,0x89,0x62,0x91,0x62,0x11,0x72,0x91,0x93,0x9d,0xe6,0x39,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd7,0xff,0xc7,0xff,0xb7,0xff,0xa7,0xff,0x97,0xff,0x87,0xbf,0x97,0xbf,0x97,0xbf,0x97,0xff,0xa7,0xff,0xb7,0xff,0xd7,0xff,0xf7,0xbf,0xe5,0x39,0xc4,0x25,0x93,0xa5,0x94,0x1d,0x63,0x15,0x41,0x8d,0x41,0x85,0x21,0x05,0x10,0x05,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x20,0x85,0x41,0x8d,0x51,0x91,0x52,0x95,0x52,0x15,0x62,0x95,0x62,0x99,0xa4,0x25,0xf7,0x3f,0xff,0xff,0xff,0xff,0xe6,0xbd,0xe6,0x3f,0xf7,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xe7,0xff,0xe7,0xff,0xc7,0xff,0xc7,0xff,0xc7,0xff,0xc7,0xff,0xc7,0xff,0xd7,0xff,0xd7,0xff,0xf7,0xff,0xff,0xff,0xff,0xbf,0xc4,0x29,0x93,0x1d,0x73,0x15,0x52,0x91,0x31,0x89,0x52,0x0d,0x31,0x8d,0x10,0x81,0x10,0x05,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x20,0x89,0x31,0x8d,0x41,0x11,0x41,0x8d,0x41,0x91,0x63,0x9d,0xa4,0xad,0x94,0xa9,0x83,0xa1,0x73,0x15,0x93,0xa5,0xc4,0xad,0xe5,0x31,0xe4,0xb5,0xf5,0x39,0xf5,0x3f,0xfe,0xbf,0xe5,0x3d,0xd5,0x31,0xe5,0x39,0xd5,0xb9,0xd5,0xb9,0xfe,0xbf,0xf6,0x3d,0xc4,0x2d,0x93,0x9d,0x83,0x19,0x83,0x99,0x52,0x8d,0x31,0x09,0x10,0x85,0x00,0x81,0x10,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x20,0x85,0x20,0x85,0x21,0x09,0x30,0x89,0x41,0x89,0x41,0x8d,0x52,0x11,0x51,0x8d,0x31,0x09,0x51,0x91,0x93,0x1d,0xc3,0xa5,0xd4,0xad,0xe4,0xa9,0xe4,0xa9,0xd4,0xa5,0xc4,0xa1,0xb4,0xa1,0x93,0xa1,0x83,0x95,0x42,0x0d,0x31,0x09,0x11,0x09,0x10,0x01,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x01,0x00,0x85,0x10,0x01,0x10,0x85,0x20,0x81,0x10,0x05,0x10,0x85,0x31,0x09,0x31,0x09,0x31,0x8d,0x41,0x8d,0x31,0x8d,0x21,0x09,0x21,0x05,0x10,0x85,0x10,0x01,0x00,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01
@@ -0,0 +1 @@
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xc6,0x18,0xc6,0x10,0x84,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x43,0x18,0xc7,0x31,0x8d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0xc6,0x21,0x08,0x29,0x4b,0x31,0x8d,0x39,0xcf,0x39,0xcf,0x42,0x11,0x4a,0x53,0x5a,0xd7,0x5a,0x97,0x52,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x21,0x09,0x21,0x09,0x29,0x4b,0x31,0xcd,0x52,0x95,0x63,0x19,0x63,0x19,0x63,0x19,0x63,0x1b,0x6b,0x5b,0x6b,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x18,0xc7,0x21,0x09,0x29,0x4b,0x39,0xcf,0x52,0x95,0x63,0x17,0x6b,0x19,0x6b,0x5b,0x73,0x9d,0x7b,0xdf,0x7b,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x43,0x18,0xc7,0x29,0x4b,0x31,0x4d,0x39,0xcf,0x42,0x11,0x4a,0x53,0x52,0x95,0x63,0x19,0x6b,0x5b,0x73,0x9d,0x7b,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x43,0x18,0xc7,0x21,0x09,0x29,0x4b,0x31,0x8d,0x39,0xcd,0x39,0xcf,0x42,0x11,0x42,0x51,0x4a,0x53,0x52,0x95,0x52,0xd7,0x63,0x19,0x6b,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x03,0x10,0x85,0x21,0x09,0x29,0x4b,0x31,0x8d,0x39,0x8d,0x39,0xcf,0x42,0x11,0x42,0x11,0x4a,0x53,0x4a,0x53,0x52,0x95,0x5b,0x19,0x63,0x5b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x43,0x10,0x85,0x18,0xc7,0x29,0x4b,0x39,0xcd,0x42,0x11,0x42,0x11,0x4a,0x53,0x52,0xd7,0x5b,0x19,0x63,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x43,0x10,0x85,0x18,0xc7,0x21,0x09,0x21,0x09,0x29,0x4b,0x29,0x8d,0x39,0xcf,0x4a,0x53,0x52,0xd7,0x5a,0xd9,0x52,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x85,0x21,0x09,0x31,0x8d,0x31,0x8d,0x31,0xcf,0x39,0xcf,0x31,0xcf,0x31,0x8d,0x31,0x8d,0x39,0xcf,0x42,0x53,0x52,0x95,0x52,0x97,0x4a,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x10,0xc7,0x21,0x4b,0x29,0x8d,0x39,0xcf,0x39,0xd1,0x42,0x11,0x42,0x11,0x42,0x11,0x42,0x11,0x42,0x11,0x39,0xd1,0x42,0x53,0x4a,0x55,0x42,0x53,0x42,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x85,0x08,0xc7,0x11,0x09,0x21,0x4d,0x29,0xcf,0x3a,0x11,0x3a,0x13,0x42,0x11,0x42,0x51,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x53,0x4a,0x53,0x3a,0x53,0x32,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x05,0x00,0x45,0x00,0x87,0x11,0x0b,0x21,0x8f,0x31,0xd1,0x3a,0x11,0x42,0x53,0x4a,0x53,0x4a,0x53,0x4a,0x53,0x42,0x53,0x42,0x53,0x42,0x53,0x3a,0x13,0x32,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x03,0x00,0x47,0x00,0x89,0x11,0x0d,0x21,0x8f,0x29,0xd1,0x3a,0x11,0x42,0x53,0x4a,0x53,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x11,0x3a,0x13,0x32,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x03,0x00,0x05,0x00,0x87,0x08,0xc9,0x19,0x4b,0x31,0x8f,0x3a,0x11,0x42,0x13,0x42,0x11,0x42,0x11,0x3a,0x11,0x32,0x11,0x29,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x87,0x29,0x4d,0x31,0xcf,0x3a,0x11,0x39,0xd1,0x31,0xcf,0x31,0xcf,0x21,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x10,0x87,0x21,0x4b,0x31,0x8d,0x31,0xcf,0x39,0xcf,0x29,0x8d,0x19,0x09,0x10,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,0x00,0x87,0x19,0x09,0x21,0x4d,0x29,0x4d,0x31,0x8d,0x31,0x8d,0x29,0x8d,0x19,0x09,0x08,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x45,0x00,0x87,0x11,0x09,0x19,0x4b,0x29,0x4d,0x29,0x8d,0x29,0x4b,0x21,0x0b,0x18,0xc9,0x08,0x85,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x05,0x00,0x87,0x08,0xc9,0x11,0x09,0x19,0x0b,0x21,0x0b,0x21,0x4b,0x21,0x0b,0x19,0x09,0x10,0xc7,0x08,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x47,0x00,0xc9,0x08,0xc9,0x19,0x0b,0x19,0x0b,0x19,0x09,0x19,0x09,0x18,0xc9,0x10,0xc9,0x10,0xc7,0x10,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x05,0x00,0x47,0x00,0x89,0x08,0xc9,0x10,0xc9,0x11,0x09,0x10,0xc9,0x10,0xc9,0x10,0xc9,0x10,0xc9,0x10,0xc9,0x11,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x45,0x00,0x89,0x08,0xc9,0x08,0xc9,0x08,0xc9,0x08,0xc9,0x08,0xc9,0x08,0xc9,0x08,0xc9,0x08,0xcb,0x09,0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x00,0x87,0x00,0x47,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x45,0x00,0x87,0x00,0x89,0x00,0x89,0x00,0xc9,0x00,0xc9,0x00,0xcb,0x00,0xc9,0x00,0xcb,0x00,0xcb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x03,0x08,0xc7,0x10,0xcb,0x11,0x0b,0x11,0x0b,0x11,0x09,0x11,0x09,0x11,0x09,0x19,0x09,0x10,0xc7,0x08,0x87,0x00,0x45,0x00,0x05,0x00,0x05,0x00,0x45,0x00,0x45,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x89,0x00,0x89,0x00,0x8b,0x00,0xcd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x43,0x10,0xc7,0x19,0x09,0x19,0x4b,0x19,0x4b,0x19,0x4b,0x19,0x07,0x10,0xc7,0x10,0xc5,0x10,0xc5,0x10,0xc5,0x10,0xc5,0x08,0xc5,0x00,0x85,0x00,0x45,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x07,0x00,0x47,0x00,0x89,0x00,0x8b,0x01,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x45,0x10,0xc7,0x19,0x09,0x19,0x09,0x21,0x49,0x19,0x09,0x18,0xc7,0x10,0x83,0x08,0x83,0x08,0x81,0x08,0x83,0x08,0x83,0x08,0x83,0x10,0xc3,0x08,0x85,0x00,0x45,0x00,0x45,0x00,0x45,0x00,0x05,0x00,0x05,0x00,0x07,0x00,0x49,0x00,0xcf,0x01,0x11,0x01,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x85,0x10,0x87,0x18,0xc7,0x19,0x07,0x19,0x09,0x19,0x07,0x10,0x85,0x08,0x83,0x08,0x41,0x08,0x41,0x08,0x41,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x81,0x08,0x83,0x00,0x87,0x00,0x87,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0xcb,0x01,0x95,0x01,0x95,0x01,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x43,0x08,0x85,0x10,0x85,0x10,0xc5,0x10,0xc7,0x10,0xc5,0x08,0x83,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x81,0x08,0x81,0x10,0xc5,0x09,0x09,0x08,0xcb,0x00,0xc9,0x00,0xcb,0x00,0xcb,0x01,0x0d,0x01,0x93,0x09,0xd7,0x01,0x95,0x01,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x41,0x08,0x43,0x08,0x43,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x81,0x08,0x81,0x08,0x81,0x11,0x03,0x19,0x49,0x21,0x8d,0x21,0xd1,0x21,0xd1,0x22,0x15,0x22,0x57,0x22,0x99,0x22,0x9b,0x12,0x19,0x09,0xd5,0x01,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x81,0x10,0xc1,0x19,0x03,0x19,0x05,0x21,0x89,0x31,0xcf,0x3a,0x53,0x42,0x97,0x4b,0x1b,0x4b,0x5d,0x43,0x1d,0x3b,0x1d,0x32,0xdb,0x22,0x57,0x09,0x93,0x09,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x08,0x81,0x11,0x01,0x29,0x87,0x32,0x0d,0x42,0x51,0x42,0x95,0x4a,0xd7,0x53,0x19,0x5b,0x5b,0x53,0x5d,0x53,0x5d,0x4b,0x1d,0x3a,0xd9,0x2a,0x15,0x11,0x4f,0x09,0x4f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x81,0x11,0x01,0x21,0x83,0x32,0x0b,0x42,0x51,0x4a,0x95,0x4a,0xd7,0x52,0xd7,0x52,0xd9,0x53,0x19,0x53,0x19,0x5b,0x1b,0x53,0x1b,0x42,0x97,0x21,0xd1,0x11,0x0d,0x08,0xcb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x41,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x81,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x41,0x08,0xc1,0x21,0x83,0x32,0x09,0x42,0x4f,0x4a,0x93,0x4a,0x95,0x4a,0x95,0x4a,0x97,0x52,0xd7,0x52,0xd7,0x52,0xd7,0x52,0xd9,0x4a,0xd9,0x3a,0x55,0x21,0x8f,0x08,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x08,0x41,0x08,0x81,0x00,0x81,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x81,0x19,0x81,0x31,0xc7,0x3a,0x0d,0x42,0x11,0x42,0x11,0x42,0x13,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x53,0x42,0x95,0x4a,0x99,0x42,0x97,0x32,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x41,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x81,0x11,0x01,0x21,0x85,0x31,0xcb,0x39,0xcd,0x39,0xcf,0x31,0xcf,0x31,0xcf,0x31,0xcf,0x31,0xcf,0x31,0x8d,0x31,0x8d,0x31,0xd1,0x3a,0x53,0x4a,0xd9,0x42,0xd9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x83,0x08,0x83,0x08,0x81,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x81,0x00,0xc1,0x19,0x41,0x29,0x87,0x31,0x89,0x31,0x8b,0x31,0x8b,0x31,0x8b,0x29,0x8b,0x29,0x8b,0x29,0x4b,0x21,0x09,0x21,0x0b,0x29,0x8d,0x3a,0x55,0x4a,0xd7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x41,0x08,0x81,0x08,0x81,0x08,0x81,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x41,0x00,0xc1,0x11,0x41,0x21,0x85,0x21,0x87,0x29,0x87,0x29,0x49,0x29,0x89,0x29,0x49,0x29,0x49,0x18,0xc7,0x10,0xc7,0x19,0x09,0x21,0x4d,0x3a,0x53,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x41,0x08,0x81,0x08,0x81,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0xc1,0x09,0x01,0x19,0x41,0x19,0x43,0x19,0x05,0x21,0x47,0x19,0x05,0x18,0xc7,0x10,0xc5,0x10,0x85,0x18,0xc7,0x19,0x09,0x29,0xcf,0x00,0x00,0x00,0x00,0x00,0x01,0x08,0x41,0x08,0x81,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x81,0x08,0xc1,0x10,0xc1,0x08,0xc1,0x08,0xc1,0x00,0x41,0x08,0x41,0x08,0x83,0x10,0x83,0x10,0xc5,0x19,0x09,0x21,0x4b,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x41,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x08,0x41,0x18,0xc5,0x29,0x49,0x31,0xcd,0x21,0x49,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x08,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x10,0x81,0x21,0x47,0x3a,0x0d,0x42,0x51,0x21,0x49,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x41,0x08,0x81,0x08,0x81,0x08,0x41,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x41,0x00,0x81,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x08,0x81,0x21,0x45,0x3a,0x0d,0x4a,0x91,0x32,0x0d,0x00,0x00,0x00,0x00,0x08,0x41,0x10,0x83,0x10,0xc3,0x10,0x81,0x08,0x81,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x10,0xc1,0x29,0xc9,0x3a,0x4b,0x29,0xc9,0x00,0x00,0x08,0x42,0x10,0x83,0x10,0xc5,0x18,0xc5,0x10,0xc1,0x08,0x81,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x11,0x01,0x11,0x03,0x00,0x41,0x00,0x00,0x08,0x42,0x10,0x85,0x18,0xc5,0x18,0xc5,0x18,0xc3,0x10,0xc1,0x10,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x41,0x00,0x81,0x00,0x01,0x00,0x00,0x00,0x00,0x10,0xc5,0x18,0xc7,0x18,0xc7,0x19,0x07,0x19,0x05,0x18,0xc5,0x18,0xc3,0x08,0x81,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x85,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x18,0xc5,0x19,0x05,0x21,0x07,0x21,0x07,0x18,0xc5,0x00,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x43,0x18,0xc5,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x21,0x07,0x29,0x49,0x21,0x09,0x10,0x85,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x18,0xc5,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x21,0x07,0x21,0x09,0x20,0xc7,0x10,0x83,0x08,0x41,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x10,0x85,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x10,0x85,0x10,0x85,0x18,0xc7,0x21,0x07,0x19,0x07,0x10,0x85,0x08,0x43,0x08,0x43,0x08,0x43,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x43,0x08,0x43,0x18,0xc7,0x18,0xc7,0x18,0xc7,0x10,0x83,0x08,0x43,0x10,0x85,0x10,0x85,0x18,0xc5,0x10,0x85,0x10,0x83,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0x00,0x01,0x10,0x85,0x18,0xc7,0x18,0xc7,0x10,0x85,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x08,0x43,0x10,0x85,0x10,0x85,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
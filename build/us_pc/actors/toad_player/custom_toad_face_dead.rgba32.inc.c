@@ -0,0 +1 @@
+0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xee,0xff,0xff,0xf6,0xee,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xee,0xff,0xff,0xff,0xee,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xd5,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xff,0xee,0xd5,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xee,0xd5,0xff,0xff,0xe6,0xcd,0xff,0xff,0xe6,0xc5,0xff,0xff,0xe6,0xc5,0xff,0xf6,0xde,0xbd,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xd5,0xac,0xff,0xf6,0xd5,0xac,0xff,0xf6,0xd5,0xac,0xff,0xf6,0xd5,0xac,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xde,0xbd,0xff,0xff,0xe6,0xc5,0xff,0xff,0xe6,0xc5,0xff,0xff,0xe6,0xcd,0xff,0xff,0xee,0xd5,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xee,0xff,0xff,0xee,0xde,0xff,0xff,0xe6,0xcd,0xff,0xf6,0xe6,0xbd,0xff,0xf6,0xde,0xbd,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xd5,0xa4,0xff,0xf6,0xcd,0x9c,0xff,0xee,0xcd,0x9c,0xff,0xee,0xcd,0x94,0xff,0xee,0xcd,0x94,0xff,0xee,0xcd,0x9c,0xff,0xf6,0xcd,0x9c,0xff,0xf6,0xd5,0xa4,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xde,0xbd,0xff,0xf6,0xe6,0xbd,0xff,0xff,0xe6,0xcd,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xee,0xff,0xff,0xee,0xd5,0xff,0xff,0xe6,0xc5,0xff,0xf6,0xde,0xbd,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xd5,0xa4,0xff,0xee,0xcd,0x9c,0xff,0xee,0xcd,0x94,0xff,0xee,0xcd,0x94,0xff,0xee,0xc5,0x94,0xff,0xee,0xc5,0x94,0xff,0xee,0xcd,0x94,0xff,0xee,0xcd,0x94,0xff,0xee,0xcd,0x9c,0xff,0xf6,0xd5,0xa4,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xde,0xbd,0xff,0xff,0xe6,0xc5,0xff,0xff,0xee,0xd5,0xff,0xff,0xf6,0xee,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xee,0xd5,0xff,0xff,0xe6,0xcd,0xff,0xf6,0xde,0xbd,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xd5,0xac,0xff,0xf6,0xd5,0xa4,0xff,0xf6,0xcd,0xa4,0xff,0xf6,0xcd,0x9c,0xff,0xf6,0xcd,0x9c,0xff,0xf6,0xcd,0x9c,0xff,0xf6,0xcd,0x9c,0xff,0xf6,0xcd,0xa4,0xff,0xf6,0xd5,0xa4,0xff,0xf6,0xd5,0xac,0xff,0xf6,0xde,0xb4,0xff,0xf6,0xde,0xbd,0xff,0xff,0xe6,0xcd,0xff,0xff,0xee,0xd5,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xee,0xff,0xff,0xee,0xde,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xc5,0xff,0xf6,0xe6,0xbd,0xff,0xf6,0xe6,0xbd,0xff,0xf6,0xd5,0xbd,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xbd,0xff,0xf6,0xe6,0xbd,0xff,0xf6,0xe6,0xbd,0xff,0xf6,0xe6,0xc5,0xff,0xf6,0xe6,0xcd,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xee,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xee,0xff,0xff,0xf6,0xe6,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xf6,0xee,0xd5,0xff,0xf6,0xee,0xd5,0xff,0xf6,0xee,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xee,0xcd,0xff,0xf6,0xee,0xd5,0xff,0xf6,0xee,0xd5,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xee,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xde,0xff,0xff,0xee,0xde,0xff,0xf6,0xee,0xcd,0xff,0xee,0xd5,0xb4,0xff,0xcd,0xb4,0x9c,0xff,0xcd,0xb4,0x9c,0xff,0xcd,0xb4,0x9c,0xff,0xcd,0xb4,0x9c,0xff,0xee,0xd5,0xb4,0xff,0xf6,0xee,0xcd,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xde,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xf6,0xff,0xf6,0xe6,0xde,0xff,0xac,0x8b,0x73,0xff,0x6a,0x41,0x31,0xff,0x31,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x31,0x00,0x08,0xff,0x6a,0x41,0x31,0xff,0xac,0x8b,0x73,0xff,0xf6,0xe6,0xde,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xf6,0xee,0xe6,0xff,0x9c,0x73,0x73,0xff,0x41,0x08,0x18,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x41,0x08,0x18,0xff,0x9c,0x73,0x73,0xff,0xf6,0xee,0xe6,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xd5,0xb4,0xff,0xcd,0xb4,0x9c,0xff,0x62,0x31,0x20,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x62,0x31,0x20,0xff,0xcd,0xb4,0x9c,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xe6,0xcd,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xf6,0xe6,0xbd,0xff,0xde,0xbd,0x7b,0xff,0x9c,0x73,0x62,0xff,0x31,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x31,0x00,0x08,0xff,0x9c,0x73,0x62,0xff,0xde,0xbd,0x7b,0xff,0xf6,0xe6,0xbd,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xf6,0xee,0xcd,0xff,0xf6,0xcd,0x9c,0xff,0xa4,0x7b,0x62,0xff,0x31,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x39,0x00,0x08,0xff,0x41,0x00,0x18,0xff,0x41,0x00,0x18,0xff,0x39,0x00,0x08,0xff,0x20,0x00,0x08,0xff,0x29,0x00,0x08,0xff,0x31,0x00,0x08,0xff,0xa4,0x7b,0x62,0xff,0xf6,0xcd,0x9c,0xff,0xf6,0xee,0xcd,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xee,0xde,0xff,0xf6,0xd5,0xa4,0xff,0xb4,0x9c,0x62,0xff,0x6a,0x41,0x31,0xff,0x31,0x00,0x08,0xff,0x62,0x08,0x20,0xff,0xac,0x18,0x4a,0xff,0xcd,0x31,0x73,0xff,0xcd,0x31,0x73,0xff,0xac,0x18,0x4a,0xff,0x62,0x08,0x20,0xff,0x31,0x00,0x08,0xff,0x6a,0x41,0x31,0xff,0xb4,0x9c,0x62,0xff,0xf6,0xd5,0xa4,0xff,0xff,0xee,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xf6,0xe6,0xbd,0xff,0xd5,0xbd,0x8b,0xff,0xf6,0xe6,0xde,0xff,0xde,0xb4,0xa4,0xff,0xcd,0x4a,0x73,0xff,0xd5,0x31,0x62,0xff,0xde,0x5a,0x9c,0xff,0xde,0x5a,0x9c,0xff,0xd5,0x31,0x62,0xff,0xcd,0x4a,0x73,0xff,0xde,0xb4,0xa4,0xff,0xf6,0xe6,0xde,0xff,0xd5,0xbd,0x8b,0xff,0xf6,0xe6,0xbd,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xee,0xde,0xff,0xf6,0xee,0xcd,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf6,0xe6,0xff,0xf6,0xee,0xcd,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xe6,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xee,0xde,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xe6,0xff,0xff,0xe6,0xc5,0xff,0xf6,0xde,0xbd,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xd5,0xb4,0xff,0xf6,0xde,0xbd,0xff,0xff,0xe6,0xc5,0xff,0xff,0xf6,0xe6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xee,0xe6,0xff,0xf6,0xe6,0xd5,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xcd,0xff,0xf6,0xe6,0xd5,0xff,0xff,0xee,0xe6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xf6,0xee,0xff,0xff,0xf6,0xee,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xe6,0xff,0xff,0xf6,0xee,0xff,0xff,0xf6,0xee,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xee,0xff,0xff,0xf6,0xf6,0xff,0xff,0xf6,0xf6,0xff,0xff,0xff,0xee,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xf6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff
@@ -0,0 +1 @@
+0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xef,0x7b,0xef,0x7b,0xd6,0xb5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xd6,0xb5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb5,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xc6,0x31,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x8c,0x63,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0xc6,0x31,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xa5,0x29,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xa5,0x29,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0xb5,0xad,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xd6,0xb5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xef,0x7b,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x8c,0x63,0xef,0x7b,0xff,0xff,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xd6,0xb5,0xb5,0xad,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x5a,0xd7,0xd6,0xb5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x6b,0x5b,0x8c,0x63,0xd6,0xb5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xb5,0xad,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x6b,0x5b,0x8c,0x63,0xc6,0x31,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xc6,0x31,0xb5,0xad,0xb5,0xad,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x6b,0x5b,0x7b,0xdf,0x8c,0x63,0xb5,0xad,0xd6,0xb5,0xd6,0xb5,0xd6,0xb5,0xb5,0xad,0xb5,0xad,0xa5,0x29,0xa5,0x29,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x8c,0x63,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x42,0x11,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x8c,0x63,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x7b,0xdf,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x7b,0xdf,0x5a,0xd7,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x5a,0xd7,0x6b,0x5b,0xd6,0xb5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xa5,0x29,0x42,0x11,0x5a,0xd7,0x6b,0x5b,0x6b,0x5b,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x7b,0xdf,0x6b,0x5b,0x6b,0x5b,0x5a,0xd7,0x6b,0x5b,0x8c,0x63,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xef,0x7b,0x7b,0xdf,0x42,0x11,0x5a,0xd7,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x6b,0x5b,0x5a,0xd7,0x5a,0xd7,0x6b,0x5b,0x8c,0x63,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0xd6,0xb5,0xb5,0xad,0x7b,0xdf,0x7b,0xdf,0x8c,0x63,0xd6,0xb5,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4,0x94,0xa4
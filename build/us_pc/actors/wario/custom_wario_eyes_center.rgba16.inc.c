@@ -0,0 +1 @@
+0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xcf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x39,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xcf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x39,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x39,0xcf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x39,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xcf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x39,0xcf,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x7b,0xdf,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x7b,0xdf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x39,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x39,0xcf,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x39,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x39,0xcf,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x39,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x39,0xcf,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x39,0xcf,0x5a,0xd7,0x5a,0xd7,0x5a,0xd7,0x5a,0xd7,0x39,0xcf,0x21,0x09,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x21,0x09,0x39,0xcf,0x5a,0xd7,0x5a,0xd7,0x5a,0xd7,0x5a,0xd7,0x39,0xcf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x7b,0xdf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x09,0x8f,0x24,0xaf,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xde,0xf7,0xbd,0xef,0x7b,0xdf,0x39,0xcf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x39,0xcf,0x7b,0xdf,0xbd,0xef,0xde,0xf7,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xff,0x24,0xaf,0x09,0x8f,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x7b,0xdf,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x1b,0x1f,0x35,0xfd,0x66,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0xbd,0xef,0x39,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x39,0xcf,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x39,0xcf,0x08,0x03,0x08,0x03,0x08,0x03,0x08,0x03,0x39,0xcf,0xbd,0xef,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0x7d,0x35,0xfd,0x1b,0x1f,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x21,0x09,0x24,0xaf,0x35,0xfd,0x35,0xfd,0xcf,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0x7b,0xdf,0x21,0x09,0x08,0x03,0x08,0x03,0x08,0x03,0x7b,0xdf,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x00,0x00,0x7b,0xdf,0x08,0x03,0x08,0x03,0x08,0x03,0x21,0x09,0x7b,0xdf,0xef,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x7f,0x35,0xfd,0x35,0xfd,0x24,0xaf,0x21,0x09,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x9e,0xff,0x35,0xfd,0x35,0xfd,0x66,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0xef,0x21,0x09,0x08,0x03,0x08,0x03,0x21,0x09,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0x21,0x09,0x08,0x03,0x08,0x03,0x21,0x09,0xbd,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x9e,0xff,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0xef,0x21,0x09,0x08,0x03,0x08,0x03,0x39,0xcf,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x39,0xcf,0x08,0x03,0x08,0x03,0x21,0x09,0xbd,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xff,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfd,0x35,0xfd,0x35,0xfd,0xcf,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xdf,0x39,0xcf,0x39,0xcf,0x7b,0xdf,0xff,0xff,0xff,0xff,0xbd,0xef,0x21,0x09,0x08,0x03,0x21,0x09,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x21,0x09,0x08,0x03,0x21,0x09,0xbd,0xef,0xff,0xff,0xff,0xff,0x7b,0xdf,0x39,0xcf,0x39,0xcf,0x7b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x7f,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfd,0x35,0xfd,0x35,0xfd,0xcf,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xdf,0x21,0x09,0x00,0x01,0x00,0x01,0x21,0x09,0x7b,0xdf,0xff,0xff,0xff,0xff,0x7b,0xdf,0x21,0x09,0x08,0x03,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x08,0x03,0x21,0x09,0x7b,0xdf,0xff,0xff,0xff,0xff,0x7b,0xdf,0x21,0x09,0x00,0x01,0x00,0x01,0x21,0x09,0x7b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x7f,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfd,0x35,0xfd,0x35,0xfd,0xcf,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0xcf,0x00,0x01,0xbd,0xef,0xff,0xff,0x00,0x01,0x39,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0xcf,0x08,0x03,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x08,0x03,0x39,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0xcf,0x00,0x01,0xff,0xff,0xbd,0xef,0x00,0x01,0x39,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x7f,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0xcf,0x00,0x01,0xbd,0xef,0xde,0xf7,0x00,0x01,0x39,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x21,0x09,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x21,0x09,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0xcf,0x00,0x01,0xde,0xf7,0xbd,0xef,0x00,0x01,0x39,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xff,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x66,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xdf,0x21,0x09,0x00,0x01,0x00,0x01,0x21,0x09,0x7b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xfe,0x00,0x00,0x00,0x00,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xdf,0x21,0x09,0x00,0x01,0x00,0x01,0x21,0x09,0x7b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfc,0x35,0xfd,0x35,0xfd,0x35,0xfd,0xcf,0x7f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xdf,0x39,0xcf,0x39,0xcf,0x7b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7b,0xdf,0x39,0xcf,0x39,0xcf,0x7b,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,0x7f,0x35,0xfd,0x35,0xfd,0x35,0xfd,0x35,0xfc,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x66,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfc,0x66,0x7d,0x35,0xfd,0x35,0xfd,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xff,0x35,0xfd,0x35,0xfd,0x66,0x7d,0x35,0xfc,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0x35,0xfc,0x35,0xfc,0x35,0xfc,0x35,0xfc,0x35,0xfc,0x35,0xfc,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0xfc,0x35,0xfc,0x35,0xfc,0x35,0xfc,0x35,0xfc,0x35,0xfc,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe,0xff,0xfe
@@ -0,0 +1,1799 @@
+#include "types.h"
+#include <stddef.h>
+#include "pc/rom_assets.h"
+
+struct MarioAnimsObj {
+u32 numEntries;
+const struct Animation *addrPlaceholder;
+struct OffsetSizePair entries[209];
+struct Animation anim_00;
+s16 anim_00_indices[126];
+s16 anim_00_values[1302];
+struct Animation anim_01;
+struct Animation anim_02;
+s16 anim_01_02_indices[126];
+s16 anim_01_02_values[3288];
+struct Animation anim_03;
+s16 anim_03_indices[126];
+s16 anim_03_values[2186];
+struct Animation anim_04;
+s16 anim_04_indices[126];
+s16 anim_04_values[1132];
+struct Animation anim_05;
+s16 anim_05_indices[126];
+s16 anim_05_values[2898];
+struct Animation anim_06;
+s16 anim_06_indices[126];
+s16 anim_06_values[446];
+struct Animation anim_07;
+struct Animation anim_08;
+s16 anim_07_08_indices[126];
+s16 anim_07_08_values[734];
+struct Animation anim_09;
+s16 anim_09_indices[126];
+s16 anim_09_values[1526];
+struct Animation anim_0A;
+s16 anim_0A_indices[126];
+s16 anim_0A_values[1272];
+struct Animation anim_0B;
+struct Animation anim_0C;
+s16 anim_0B_0C_indices[126];
+s16 anim_0B_0C_values[674];
+struct Animation anim_0D;
+s16 anim_0D_indices[126];
+s16 anim_0D_values[385];
+struct Animation anim_0E;
+s16 anim_0E_indices[126];
+s16 anim_0E_values[40];
+struct Animation anim_0F;
+struct Animation anim_10;
+s16 anim_0F_10_indices[126];
+s16 anim_0F_10_values[751];
+struct Animation anim_11;
+s16 anim_11_indices[126];
+s16 anim_11_values[587];
+struct Animation anim_12;
+s16 anim_12_indices[126];
+s16 anim_12_values[659];
+struct Animation anim_13;
+s16 anim_13_indices[126];
+s16 anim_13_values[839];
+struct Animation anim_14;
+s16 anim_14_indices[126];
+s16 anim_14_values[551];
+struct Animation anim_15;
+s16 anim_15_indices[126];
+s16 anim_15_values[465];
+struct Animation anim_16;
+s16 anim_16_indices[126];
+s16 anim_16_values[2226];
+struct Animation anim_17;
+s16 anim_17_indices[126];
+s16 anim_17_values[1471];
+struct Animation anim_18;
+s16 anim_18_indices[126];
+s16 anim_18_values[2226];
+struct Animation anim_19;
+s16 anim_19_indices[126];
+s16 anim_19_values[2677];
+struct Animation anim_1A;
+s16 anim_1A_indices[126];
+s16 anim_1A_values[573];
+struct Animation anim_1B;
+s16 anim_1B_indices[126];
+s16 anim_1B_values[1429];
+struct Animation anim_1C;
+s16 anim_1C_indices[126];
+s16 anim_1C_values[390];
+struct Animation anim_1D;
+s16 anim_1D_indices[126];
+s16 anim_1D_values[690];
+struct Animation anim_1E;
+s16 anim_1E_indices[126];
+s16 anim_1E_values[765];
+struct Animation anim_1F;
+s16 anim_1F_indices[126];
+s16 anim_1F_values[423];
+struct Animation anim_20;
+s16 anim_20_indices[126];
+s16 anim_20_values[3562];
+struct Animation anim_21;
+s16 anim_21_indices[126];
+s16 anim_21_values[1305];
+struct Animation anim_22;
+s16 anim_22_indices[126];
+s16 anim_22_values[875];
+struct Animation anim_23;
+s16 anim_23_indices[126];
+s16 anim_23_values[4108];
+struct Animation anim_24;
+s16 anim_24_indices[126];
+s16 anim_24_values[4688];
+struct Animation anim_25;
+s16 anim_25_indices[126];
+s16 anim_25_values[4009];
+struct Animation anim_26;
+s16 anim_26_indices[126];
+s16 anim_26_values[3676];
+struct Animation anim_27;
+s16 anim_27_indices[126];
+s16 anim_27_values[4490];
+struct Animation anim_28;
+s16 anim_28_indices[126];
+s16 anim_28_values[505];
+struct Animation anim_29;
+s16 anim_29_indices[126];
+s16 anim_29_values[291];
+struct Animation anim_2A;
+s16 anim_2A_indices[126];
+s16 anim_2A_values[626];
+struct Animation anim_2B;
+s16 anim_2B_indices[126];
+s16 anim_2B_values[791];
+struct Animation anim_2C;
+struct Animation anim_2D;
+s16 anim_2C_2D_indices[126];
+s16 anim_2C_2D_values[2810];
+struct Animation anim_2E;
+s16 anim_2E_indices[126];
+s16 anim_2E_values[1514];
+struct Animation anim_2F;
+s16 anim_2F_indices[126];
+s16 anim_2F_values[3710];
+struct Animation anim_30;
+s16 anim_30_indices[126];
+s16 anim_30_values[2714];
+struct Animation anim_31;
+s16 anim_31_indices[126];
+s16 anim_31_values[5330];
+struct Animation anim_32;
+s16 anim_32_indices[126];
+s16 anim_32_values[3945];
+struct Animation anim_33;
+s16 anim_33_indices[126];
+s16 anim_33_values[1420];
+struct Animation anim_34;
+s16 anim_34_indices[126];
+s16 anim_34_values[650];
+struct Animation anim_35;
+s16 anim_35_indices[126];
+s16 anim_35_values[1852];
+struct Animation anim_36;
+s16 anim_36_indices[126];
+s16 anim_36_values[1850];
+struct Animation anim_37;
+s16 anim_37_indices[126];
+s16 anim_37_values[3414];
+struct Animation anim_38;
+s16 anim_38_indices[126];
+s16 anim_38_values[422];
+struct Animation anim_39;
+s16 anim_39_indices[126];
+s16 anim_39_values[6209];
+struct Animation anim_3A;
+s16 anim_3A_indices[126];
+s16 anim_3A_values[187];
+struct Animation anim_3B;
+s16 anim_3B_indices[126];
+s16 anim_3B_values[602];
+struct Animation anim_3C;
+struct Animation anim_3D;
+s16 anim_3C_3D_indices[126];
+s16 anim_3C_3D_values[387];
+struct Animation anim_3E;
+s16 anim_3E_indices[126];
+s16 anim_3E_values[5745];
+struct Animation anim_3F;
+s16 anim_3F_indices[126];
+s16 anim_3F_values[1547];
+struct Animation anim_40;
+s16 anim_40_indices[126];
+s16 anim_40_values[547];
+struct Animation anim_41;
+s16 anim_41_indices[126];
+s16 anim_41_values[268];
+struct Animation anim_42;
+s16 anim_42_indices[126];
+s16 anim_42_values[478];
+struct Animation anim_43;
+s16 anim_43_indices[126];
+s16 anim_43_values[42];
+struct Animation anim_44;
+s16 anim_44_indices[126];
+s16 anim_44_values[325];
+struct Animation anim_45;
+struct Animation anim_46;
+s16 anim_45_46_indices[126];
+s16 anim_45_46_values[595];
+struct Animation anim_47;
+s16 anim_47_indices[126];
+s16 anim_47_values[419];
+struct Animation anim_48;
+s16 anim_48_indices[126];
+s16 anim_48_values[2549];
+struct Animation anim_49;
+s16 anim_49_indices[126];
+s16 anim_49_values[649];
+struct Animation anim_4A;
+s16 anim_4A_indices[126];
+s16 anim_4A_values[308];
+struct Animation anim_4B;
+s16 anim_4B_indices[126];
+s16 anim_4B_values[693];
+struct Animation anim_4C;
+s16 anim_4C_indices[126];
+s16 anim_4C_values[335];
+struct Animation anim_4D;
+struct Animation anim_4E;
+s16 anim_4D_4E_indices[126];
+s16 anim_4D_4E_values[1228];
+struct Animation anim_4F;
+s16 anim_4F_indices[126];
+s16 anim_4F_values[789];
+struct Animation anim_50;
+s16 anim_50_indices[126];
+s16 anim_50_values[210];
+struct Animation anim_51;
+s16 anim_51_indices[126];
+s16 anim_51_values[501];
+struct Animation anim_52;
+s16 anim_52_indices[126];
+s16 anim_52_values[439];
+struct Animation anim_53;
+s16 anim_53_indices[126];
+s16 anim_53_values[985];
+struct Animation anim_54;
+s16 anim_54_indices[126];
+s16 anim_54_values[657];
+struct Animation anim_55;
+s16 anim_55_indices[126];
+s16 anim_55_values[5634];
+struct Animation anim_56;
+struct Animation anim_57;
+s16 anim_56_57_indices[126];
+s16 anim_56_57_values[780];
+struct Animation anim_58;
+s16 anim_58_indices[126];
+s16 anim_58_values[541];
+struct Animation anim_59;
+s16 anim_59_indices[126];
+s16 anim_59_values[1526];
+struct Animation anim_5A;
+s16 anim_5A_indices[126];
+s16 anim_5A_values[1639];
+struct Animation anim_5B;
+s16 anim_5B_indices[126];
+s16 anim_5B_values[360];
+struct Animation anim_5C;
+s16 anim_5C_indices[126];
+s16 anim_5C_values[629];
+struct Animation anim_5D;
+s16 anim_5D_indices[126];
+s16 anim_5D_values[571];
+struct Animation anim_5E;
+s16 anim_5E_indices[126];
+s16 anim_5E_values[6055];
+struct Animation anim_5F;
+s16 anim_5F_indices[126];
+s16 anim_5F_values[2529];
+struct Animation anim_60;
+s16 anim_60_indices[126];
+s16 anim_60_values[2010];
+struct Animation anim_61;
+s16 anim_61_indices[126];
+s16 anim_61_values[6330];
+struct Animation anim_62;
+s16 anim_62_indices[126];
+s16 anim_62_values[371];
+struct Animation anim_63;
+s16 anim_63_indices[126];
+s16 anim_63_values[813];
+struct Animation anim_64;
+s16 anim_64_indices[126];
+s16 anim_64_values[623];
+struct Animation anim_65;
+s16 anim_65_indices[126];
+s16 anim_65_values[850];
+struct Animation anim_66;
+s16 anim_66_indices[126];
+s16 anim_66_values[974];
+struct Animation anim_67;
+s16 anim_67_indices[126];
+s16 anim_67_values[193];
+struct Animation anim_68;
+s16 anim_68_indices[126];
+s16 anim_68_values[170];
+struct Animation anim_69;
+s16 anim_69_indices[126];
+s16 anim_69_values[382];
+struct Animation anim_6A;
+s16 anim_6A_indices[126];
+s16 anim_6A_values[530];
+struct Animation anim_6B;
+s16 anim_6B_indices[126];
+s16 anim_6B_values[470];
+struct Animation anim_6C;
+s16 anim_6C_indices[126];
+s16 anim_6C_values[642];
+struct Animation anim_6D;
+s16 anim_6D_indices[126];
+s16 anim_6D_values[643];
+struct Animation anim_6E;
+s16 anim_6E_indices[126];
+s16 anim_6E_values[568];
+struct Animation anim_6F;
+struct Animation anim_70;
+s16 anim_6F_70_indices[126];
+s16 anim_6F_70_values[49];
+struct Animation anim_71;
+s16 anim_71_indices[126];
+s16 anim_71_values[1039];
+struct Animation anim_72;
+struct Animation anim_73;
+s16 anim_72_73_indices[126];
+s16 anim_72_73_values[2171];
+struct Animation anim_74;
+s16 anim_74_indices[126];
+s16 anim_74_values[922];
+struct Animation anim_75;
+s16 anim_75_indices[126];
+s16 anim_75_values[946];
+struct Animation anim_76;
+s16 anim_76_indices[126];
+s16 anim_76_values[2324];
+struct Animation anim_77;
+s16 anim_77_indices[126];
+s16 anim_77_values[1232];
+struct Animation anim_78;
+s16 anim_78_indices[126];
+s16 anim_78_values[5227];
+struct Animation anim_79;
+s16 anim_79_indices[126];
+s16 anim_79_values[1817];
+struct Animation anim_7A;
+s16 anim_7A_indices[126];
+s16 anim_7A_values[201];
+struct Animation anim_7B;
+s16 anim_7B_indices[126];
+s16 anim_7B_values[1180];
+struct Animation anim_7C;
+s16 anim_7C_indices[126];
+s16 anim_7C_values[1150];
+struct Animation anim_7D;
+s16 anim_7D_indices[126];
+s16 anim_7D_values[557];
+struct Animation anim_7E;
+s16 anim_7E_indices[126];
+s16 anim_7E_values[2269];
+struct Animation anim_7F;
+s16 anim_7F_indices[126];
+s16 anim_7F_values[1811];
+struct Animation anim_80;
+s16 anim_80_indices[126];
+s16 anim_80_values[2124];
+struct Animation anim_81;
+s16 anim_81_indices[126];
+s16 anim_81_values[2154];
+struct Animation anim_82;
+s16 anim_82_indices[126];
+s16 anim_82_values[2885];
+struct Animation anim_83;
+s16 anim_83_indices[126];
+s16 anim_83_values[2367];
+struct Animation anim_84;
+s16 anim_84_indices[126];
+s16 anim_84_values[2378];
+struct Animation anim_85;
+s16 anim_85_indices[126];
+s16 anim_85_values[162];
+struct Animation anim_86;
+s16 anim_86_indices[126];
+s16 anim_86_values[1451];
+struct Animation anim_87;
+s16 anim_87_indices[126];
+s16 anim_87_values[782];
+struct Animation anim_88;
+struct Animation anim_89;
+s16 anim_88_89_indices[126];
+s16 anim_88_89_values[630];
+struct Animation anim_8A;
+s16 anim_8A_indices[126];
+s16 anim_8A_values[1490];
+struct Animation anim_8B;
+s16 anim_8B_indices[126];
+s16 anim_8B_values[1485];
+struct Animation anim_8C;
+s16 anim_8C_indices[126];
+s16 anim_8C_values[323];
+struct Animation anim_8D;
+s16 anim_8D_indices[126];
+s16 anim_8D_values[543];
+struct Animation anim_8E;
+struct Animation anim_8F;
+s16 anim_8E_8F_indices[126];
+s16 anim_8E_8F_values[809];
+struct Animation anim_90;
+s16 anim_90_indices[126];
+s16 anim_90_values[506];
+struct Animation anim_91;
+s16 anim_91_indices[126];
+s16 anim_91_values[133];
+struct Animation anim_92;
+s16 anim_92_indices[126];
+s16 anim_92_values[2800];
+struct Animation anim_93;
+s16 anim_93_indices[126];
+s16 anim_93_values[301];
+struct Animation anim_94;
+s16 anim_94_indices[126];
+s16 anim_94_values[40];
+struct Animation anim_95;
+s16 anim_95_indices[126];
+s16 anim_95_values[140];
+struct Animation anim_96;
+s16 anim_96_indices[126];
+s16 anim_96_values[340];
+struct Animation anim_97;
+s16 anim_97_indices[126];
+s16 anim_97_values[208];
+struct Animation anim_98;
+s16 anim_98_indices[126];
+s16 anim_98_values[1379];
+struct Animation anim_99;
+s16 anim_99_indices[126];
+s16 anim_99_values[3507];
+struct Animation anim_9A;
+s16 anim_9A_indices[126];
+s16 anim_9A_values[322];
+struct Animation anim_9B;
+s16 anim_9B_indices[126];
+s16 anim_9B_values[315];
+struct Animation anim_9C;
+s16 anim_9C_indices[126];
+s16 anim_9C_values[2442];
+struct Animation anim_9D;
+s16 anim_9D_indices[126];
+s16 anim_9D_values[972];
+struct Animation anim_9E;
+s16 anim_9E_indices[126];
+s16 anim_9E_values[2004];
+struct Animation anim_9F;
+s16 anim_9F_indices[126];
+s16 anim_9F_values[387];
+struct Animation anim_A0;
+s16 anim_A0_indices[126];
+s16 anim_A0_values[195];
+struct Animation anim_A1;
+s16 anim_A1_indices[126];
+s16 anim_A1_values[460];
+struct Animation anim_A2;
+s16 anim_A2_indices[126];
+s16 anim_A2_values[724];
+struct Animation anim_A3;
+s16 anim_A3_indices[126];
+s16 anim_A3_values[1295];
+struct Animation anim_A4;
+s16 anim_A4_indices[126];
+s16 anim_A4_values[825];
+struct Animation anim_A5;
+s16 anim_A5_indices[126];
+s16 anim_A5_values[2574];
+struct Animation anim_A6;
+s16 anim_A6_indices[126];
+s16 anim_A6_values[2323];
+struct Animation anim_A7;
+s16 anim_A7_indices[126];
+s16 anim_A7_values[1530];
+struct Animation anim_A8;
+s16 anim_A8_indices[126];
+s16 anim_A8_values[1955];
+struct Animation anim_A9;
+s16 anim_A9_indices[126];
+s16 anim_A9_values[864];
+struct Animation anim_AA;
+s16 anim_AA_indices[126];
+s16 anim_AA_values[486];
+struct Animation anim_AB;
+s16 anim_AB_indices[126];
+s16 anim_AB_values[375];
+struct Animation anim_AC;
+s16 anim_AC_indices[126];
+s16 anim_AC_values[853];
+struct Animation anim_AD;
+s16 anim_AD_indices[126];
+s16 anim_AD_values[930];
+struct Animation anim_AE;
+s16 anim_AE_indices[126];
+s16 anim_AE_values[478];
+struct Animation anim_AF;
+s16 anim_AF_indices[126];
+s16 anim_AF_values[1080];
+struct Animation anim_B0;
+s16 anim_B0_indices[126];
+s16 anim_B0_values[220];
+struct Animation anim_B1;
+s16 anim_B1_indices[126];
+s16 anim_B1_values[1209];
+struct Animation anim_B2;
+s16 anim_B2_indices[126];
+s16 anim_B2_values[912];
+struct Animation anim_B3;
+s16 anim_B3_indices[126];
+s16 anim_B3_values[3247];
+struct Animation anim_B4;
+s16 anim_B4_indices[126];
+s16 anim_B4_values[923];
+struct Animation anim_B5;
+struct Animation anim_B6;
+s16 anim_B5_B6_indices[126];
+s16 anim_B5_B6_values[691];
+struct Animation anim_B7;
+s16 anim_B7_indices[126];
+s16 anim_B7_values[1490];
+struct Animation anim_B8;
+s16 anim_B8_indices[126];
+s16 anim_B8_values[388];
+struct Animation anim_B9;
+s16 anim_B9_indices[126];
+s16 anim_B9_values[1034];
+struct Animation anim_BA;
+s16 anim_BA_indices[126];
+s16 anim_BA_values[493];
+struct Animation anim_BB;
+s16 anim_BB_indices[126];
+s16 anim_BB_values[2066];
+struct Animation anim_BC;
+struct Animation anim_BD;
+s16 anim_BC_BD_indices[126];
+s16 anim_BC_BD_values[764];
+struct Animation anim_BE;
+s16 anim_BE_indices[126];
+s16 anim_BE_values[380];
+struct Animation anim_BF;
+s16 anim_BF_indices[126];
+s16 anim_BF_values[968];
+struct Animation anim_C0;
+s16 anim_C0_indices[126];
+s16 anim_C0_values[1226];
+struct Animation anim_C1;
+s16 anim_C1_indices[126];
+s16 anim_C1_values[1234];
+struct Animation anim_C2;
+s16 anim_C2_indices[126];
+s16 anim_C2_values[2711];
+struct Animation anim_C3;
+s16 anim_C3_indices[126];
+s16 anim_C3_values[971];
+struct Animation anim_C4;
+s16 anim_C4_indices[126];
+s16 anim_C4_values[971];
+struct Animation anim_C5;
+s16 anim_C5_indices[126];
+s16 anim_C5_values[971];
+struct Animation anim_C6;
+s16 anim_C6_indices[126];
+s16 anim_C6_values[833];
+struct Animation anim_C7;
+s16 anim_C7_indices[126];
+s16 anim_C7_values[1422];
+struct Animation anim_C8;
+s16 anim_C8_indices[126];
+s16 anim_C8_values[824];
+struct Animation anim_C9;
+s16 anim_C9_indices[126];
+s16 anim_C9_values[970];
+struct Animation anim_CA;
+s16 anim_CA_indices[126];
+s16 anim_CA_values[999];
+struct Animation anim_CB;
+struct Animation anim_CC;
+s16 anim_CB_CC_indices[126];
+s16 anim_CB_CC_values[691];
+struct Animation anim_CD;
+s16 anim_CD_indices[126];
+s16 anim_CD_values[2592];
+struct Animation anim_CE;
+s16 anim_CE_indices[126];
+s16 anim_CE_values[730];
+struct Animation anim_CF;
+s16 anim_CF_indices[126];
+s16 anim_CF_values[1354];
+struct Animation anim_D0;
+s16 anim_D0_indices[126];
+s16 anim_D0_values[365];
+} gMarioAnims = {
+209,
+NULL,
+{
+{offsetof(struct MarioAnimsObj, anim_00), offsetof(struct MarioAnimsObj, anim_00_values) + sizeof(gMarioAnims.anim_00_values) - offsetof(struct MarioAnimsObj, anim_00)},
+{offsetof(struct MarioAnimsObj, anim_01), offsetof(struct MarioAnimsObj, anim_01_02_values) + sizeof(gMarioAnims.anim_01_02_values) - offsetof(struct MarioAnimsObj, anim_01)},
+{offsetof(struct MarioAnimsObj, anim_02), offsetof(struct MarioAnimsObj, anim_01_02_values) + sizeof(gMarioAnims.anim_01_02_values) - offsetof(struct MarioAnimsObj, anim_02)},
+{offsetof(struct MarioAnimsObj, anim_03), offsetof(struct MarioAnimsObj, anim_03_values) + sizeof(gMarioAnims.anim_03_values) - offsetof(struct MarioAnimsObj, anim_03)},
+{offsetof(struct MarioAnimsObj, anim_04), offsetof(struct MarioAnimsObj, anim_04_values) + sizeof(gMarioAnims.anim_04_values) - offsetof(struct MarioAnimsObj, anim_04)},
+{offsetof(struct MarioAnimsObj, anim_05), offsetof(struct MarioAnimsObj, anim_05_values) + sizeof(gMarioAnims.anim_05_values) - offsetof(struct MarioAnimsObj, anim_05)},
+{offsetof(struct MarioAnimsObj, anim_06), offsetof(struct MarioAnimsObj, anim_06_values) + sizeof(gMarioAnims.anim_06_values) - offsetof(struct MarioAnimsObj, anim_06)},
+{offsetof(struct MarioAnimsObj, anim_07), offsetof(struct MarioAnimsObj, anim_07_08_values) + sizeof(gMarioAnims.anim_07_08_values) - offsetof(struct MarioAnimsObj, anim_07)},
+{offsetof(struct MarioAnimsObj, anim_08), offsetof(struct MarioAnimsObj, anim_07_08_values) + sizeof(gMarioAnims.anim_07_08_values) - offsetof(struct MarioAnimsObj, anim_08)},
+{offsetof(struct MarioAnimsObj, anim_09), offsetof(struct MarioAnimsObj, anim_09_values) + sizeof(gMarioAnims.anim_09_values) - offsetof(struct MarioAnimsObj, anim_09)},
+{offsetof(struct MarioAnimsObj, anim_0A), offsetof(struct MarioAnimsObj, anim_0A_values) + sizeof(gMarioAnims.anim_0A_values) - offsetof(struct MarioAnimsObj, anim_0A)},
+{offsetof(struct MarioAnimsObj, anim_0B), offsetof(struct MarioAnimsObj, anim_0B_0C_values) + sizeof(gMarioAnims.anim_0B_0C_values) - offsetof(struct MarioAnimsObj, anim_0B)},
+{offsetof(struct MarioAnimsObj, anim_0C), offsetof(struct MarioAnimsObj, anim_0B_0C_values) + sizeof(gMarioAnims.anim_0B_0C_values) - offsetof(struct MarioAnimsObj, anim_0C)},
+{offsetof(struct MarioAnimsObj, anim_0D), offsetof(struct MarioAnimsObj, anim_0D_values) + sizeof(gMarioAnims.anim_0D_values) - offsetof(struct MarioAnimsObj, anim_0D)},
+{offsetof(struct MarioAnimsObj, anim_0E), offsetof(struct MarioAnimsObj, anim_0E_values) + sizeof(gMarioAnims.anim_0E_values) - offsetof(struct MarioAnimsObj, anim_0E)},
+{offsetof(struct MarioAnimsObj, anim_0F), offsetof(struct MarioAnimsObj, anim_0F_10_values) + sizeof(gMarioAnims.anim_0F_10_values) - offsetof(struct MarioAnimsObj, anim_0F)},
+{offsetof(struct MarioAnimsObj, anim_10), offsetof(struct MarioAnimsObj, anim_0F_10_values) + sizeof(gMarioAnims.anim_0F_10_values) - offsetof(struct MarioAnimsObj, anim_10)},
+{offsetof(struct MarioAnimsObj, anim_11), offsetof(struct MarioAnimsObj, anim_11_values) + sizeof(gMarioAnims.anim_11_values) - offsetof(struct MarioAnimsObj, anim_11)},
+{offsetof(struct MarioAnimsObj, anim_12), offsetof(struct MarioAnimsObj, anim_12_values) + sizeof(gMarioAnims.anim_12_values) - offsetof(struct MarioAnimsObj, anim_12)},
+{offsetof(struct MarioAnimsObj, anim_13), offsetof(struct MarioAnimsObj, anim_13_values) + sizeof(gMarioAnims.anim_13_values) - offsetof(struct MarioAnimsObj, anim_13)},
+{offsetof(struct MarioAnimsObj, anim_14), offsetof(struct MarioAnimsObj, anim_14_values) + sizeof(gMarioAnims.anim_14_values) - offsetof(struct MarioAnimsObj, anim_14)},
+{offsetof(struct MarioAnimsObj, anim_15), offsetof(struct MarioAnimsObj, anim_15_values) + sizeof(gMarioAnims.anim_15_values) - offsetof(struct MarioAnimsObj, anim_15)},
+{offsetof(struct MarioAnimsObj, anim_16), offsetof(struct MarioAnimsObj, anim_16_values) + sizeof(gMarioAnims.anim_16_values) - offsetof(struct MarioAnimsObj, anim_16)},
+{offsetof(struct MarioAnimsObj, anim_17), offsetof(struct MarioAnimsObj, anim_17_values) + sizeof(gMarioAnims.anim_17_values) - offsetof(struct MarioAnimsObj, anim_17)},
+{offsetof(struct MarioAnimsObj, anim_18), offsetof(struct MarioAnimsObj, anim_18_values) + sizeof(gMarioAnims.anim_18_values) - offsetof(struct MarioAnimsObj, anim_18)},
+{offsetof(struct MarioAnimsObj, anim_19), offsetof(struct MarioAnimsObj, anim_19_values) + sizeof(gMarioAnims.anim_19_values) - offsetof(struct MarioAnimsObj, anim_19)},
+{offsetof(struct MarioAnimsObj, anim_1A), offsetof(struct MarioAnimsObj, anim_1A_values) + sizeof(gMarioAnims.anim_1A_values) - offsetof(struct MarioAnimsObj, anim_1A)},
+{offsetof(struct MarioAnimsObj, anim_1B), offsetof(struct MarioAnimsObj, anim_1B_values) + sizeof(gMarioAnims.anim_1B_values) - offsetof(struct MarioAnimsObj, anim_1B)},
+{offsetof(struct MarioAnimsObj, anim_1C), offsetof(struct MarioAnimsObj, anim_1C_values) + sizeof(gMarioAnims.anim_1C_values) - offsetof(struct MarioAnimsObj, anim_1C)},
+{offsetof(struct MarioAnimsObj, anim_1D), offsetof(struct MarioAnimsObj, anim_1D_values) + sizeof(gMarioAnims.anim_1D_values) - offsetof(struct MarioAnimsObj, anim_1D)},
+{offsetof(struct MarioAnimsObj, anim_1E), offsetof(struct MarioAnimsObj, anim_1E_values) + sizeof(gMarioAnims.anim_1E_values) - offsetof(struct MarioAnimsObj, anim_1E)},
+{offsetof(struct MarioAnimsObj, anim_1F), offsetof(struct MarioAnimsObj, anim_1F_values) + sizeof(gMarioAnims.anim_1F_values) - offsetof(struct MarioAnimsObj, anim_1F)},
+{offsetof(struct MarioAnimsObj, anim_20), offsetof(struct MarioAnimsObj, anim_20_values) + sizeof(gMarioAnims.anim_20_values) - offsetof(struct MarioAnimsObj, anim_20)},
+{offsetof(struct MarioAnimsObj, anim_21), offsetof(struct MarioAnimsObj, anim_21_values) + sizeof(gMarioAnims.anim_21_values) - offsetof(struct MarioAnimsObj, anim_21)},
+{offsetof(struct MarioAnimsObj, anim_22), offsetof(struct MarioAnimsObj, anim_22_values) + sizeof(gMarioAnims.anim_22_values) - offsetof(struct MarioAnimsObj, anim_22)},
+{offsetof(struct MarioAnimsObj, anim_23), offsetof(struct MarioAnimsObj, anim_23_values) + sizeof(gMarioAnims.anim_23_values) - offsetof(struct MarioAnimsObj, anim_23)},
+{offsetof(struct MarioAnimsObj, anim_24), offsetof(struct MarioAnimsObj, anim_24_values) + sizeof(gMarioAnims.anim_24_values) - offsetof(struct MarioAnimsObj, anim_24)},
+{offsetof(struct MarioAnimsObj, anim_25), offsetof(struct MarioAnimsObj, anim_25_values) + sizeof(gMarioAnims.anim_25_values) - offsetof(struct MarioAnimsObj, anim_25)},
+{offsetof(struct MarioAnimsObj, anim_26), offsetof(struct MarioAnimsObj, anim_26_values) + sizeof(gMarioAnims.anim_26_values) - offsetof(struct MarioAnimsObj, anim_26)},
+{offsetof(struct MarioAnimsObj, anim_27), offsetof(struct MarioAnimsObj, anim_27_values) + sizeof(gMarioAnims.anim_27_values) - offsetof(struct MarioAnimsObj, anim_27)},
+{offsetof(struct MarioAnimsObj, anim_28), offsetof(struct MarioAnimsObj, anim_28_values) + sizeof(gMarioAnims.anim_28_values) - offsetof(struct MarioAnimsObj, anim_28)},
+{offsetof(struct MarioAnimsObj, anim_29), offsetof(struct MarioAnimsObj, anim_29_values) + sizeof(gMarioAnims.anim_29_values) - offsetof(struct MarioAnimsObj, anim_29)},
+{offsetof(struct MarioAnimsObj, anim_2A), offsetof(struct MarioAnimsObj, anim_2A_values) + sizeof(gMarioAnims.anim_2A_values) - offsetof(struct MarioAnimsObj, anim_2A)},
+{offsetof(struct MarioAnimsObj, anim_2B), offsetof(struct MarioAnimsObj, anim_2B_values) + sizeof(gMarioAnims.anim_2B_values) - offsetof(struct MarioAnimsObj, anim_2B)},
+{offsetof(struct MarioAnimsObj, anim_2C), offsetof(struct MarioAnimsObj, anim_2C_2D_values) + sizeof(gMarioAnims.anim_2C_2D_values) - offsetof(struct MarioAnimsObj, anim_2C)},
+{offsetof(struct MarioAnimsObj, anim_2D), offsetof(struct MarioAnimsObj, anim_2C_2D_values) + sizeof(gMarioAnims.anim_2C_2D_values) - offsetof(struct MarioAnimsObj, anim_2D)},
+{offsetof(struct MarioAnimsObj, anim_2E), offsetof(struct MarioAnimsObj, anim_2E_values) + sizeof(gMarioAnims.anim_2E_values) - offsetof(struct MarioAnimsObj, anim_2E)},
+{offsetof(struct MarioAnimsObj, anim_2F), offsetof(struct MarioAnimsObj, anim_2F_values) + sizeof(gMarioAnims.anim_2F_values) - offsetof(struct MarioAnimsObj, anim_2F)},
+{offsetof(struct MarioAnimsObj, anim_30), offsetof(struct MarioAnimsObj, anim_30_values) + sizeof(gMarioAnims.anim_30_values) - offsetof(struct MarioAnimsObj, anim_30)},
+{offsetof(struct MarioAnimsObj, anim_31), offsetof(struct MarioAnimsObj, anim_31_values) + sizeof(gMarioAnims.anim_31_values) - offsetof(struct MarioAnimsObj, anim_31)},
+{offsetof(struct MarioAnimsObj, anim_32), offsetof(struct MarioAnimsObj, anim_32_values) + sizeof(gMarioAnims.anim_32_values) - offsetof(struct MarioAnimsObj, anim_32)},
+{offsetof(struct MarioAnimsObj, anim_33), offsetof(struct MarioAnimsObj, anim_33_values) + sizeof(gMarioAnims.anim_33_values) - offsetof(struct MarioAnimsObj, anim_33)},
+{offsetof(struct MarioAnimsObj, anim_34), offsetof(struct MarioAnimsObj, anim_34_values) + sizeof(gMarioAnims.anim_34_values) - offsetof(struct MarioAnimsObj, anim_34)},
+{offsetof(struct MarioAnimsObj, anim_35), offsetof(struct MarioAnimsObj, anim_35_values) + sizeof(gMarioAnims.anim_35_values) - offsetof(struct MarioAnimsObj, anim_35)},
+{offsetof(struct MarioAnimsObj, anim_36), offsetof(struct MarioAnimsObj, anim_36_values) + sizeof(gMarioAnims.anim_36_values) - offsetof(struct MarioAnimsObj, anim_36)},
+{offsetof(struct MarioAnimsObj, anim_37), offsetof(struct MarioAnimsObj, anim_37_values) + sizeof(gMarioAnims.anim_37_values) - offsetof(struct MarioAnimsObj, anim_37)},
+{offsetof(struct MarioAnimsObj, anim_38), offsetof(struct MarioAnimsObj, anim_38_values) + sizeof(gMarioAnims.anim_38_values) - offsetof(struct MarioAnimsObj, anim_38)},
+{offsetof(struct MarioAnimsObj, anim_39), offsetof(struct MarioAnimsObj, anim_39_values) + sizeof(gMarioAnims.anim_39_values) - offsetof(struct MarioAnimsObj, anim_39)},
+{offsetof(struct MarioAnimsObj, anim_3A), offsetof(struct MarioAnimsObj, anim_3A_values) + sizeof(gMarioAnims.anim_3A_values) - offsetof(struct MarioAnimsObj, anim_3A)},
+{offsetof(struct MarioAnimsObj, anim_3B), offsetof(struct MarioAnimsObj, anim_3B_values) + sizeof(gMarioAnims.anim_3B_values) - offsetof(struct MarioAnimsObj, anim_3B)},
+{offsetof(struct MarioAnimsObj, anim_3C), offsetof(struct MarioAnimsObj, anim_3C_3D_values) + sizeof(gMarioAnims.anim_3C_3D_values) - offsetof(struct MarioAnimsObj, anim_3C)},
+{offsetof(struct MarioAnimsObj, anim_3D), offsetof(struct MarioAnimsObj, anim_3C_3D_values) + sizeof(gMarioAnims.anim_3C_3D_values) - offsetof(struct MarioAnimsObj, anim_3D)},
+{offsetof(struct MarioAnimsObj, anim_3E), offsetof(struct MarioAnimsObj, anim_3E_values) + sizeof(gMarioAnims.anim_3E_values) - offsetof(struct MarioAnimsObj, anim_3E)},
+{offsetof(struct MarioAnimsObj, anim_3F), offsetof(struct MarioAnimsObj, anim_3F_values) + sizeof(gMarioAnims.anim_3F_values) - offsetof(struct MarioAnimsObj, anim_3F)},
+{offsetof(struct MarioAnimsObj, anim_40), offsetof(struct MarioAnimsObj, anim_40_values) + sizeof(gMarioAnims.anim_40_values) - offsetof(struct MarioAnimsObj, anim_40)},
+{offsetof(struct MarioAnimsObj, anim_41), offsetof(struct MarioAnimsObj, anim_41_values) + sizeof(gMarioAnims.anim_41_values) - offsetof(struct MarioAnimsObj, anim_41)},
+{offsetof(struct MarioAnimsObj, anim_42), offsetof(struct MarioAnimsObj, anim_42_values) + sizeof(gMarioAnims.anim_42_values) - offsetof(struct MarioAnimsObj, anim_42)},
+{offsetof(struct MarioAnimsObj, anim_43), offsetof(struct MarioAnimsObj, anim_43_values) + sizeof(gMarioAnims.anim_43_values) - offsetof(struct MarioAnimsObj, anim_43)},
+{offsetof(struct MarioAnimsObj, anim_44), offsetof(struct MarioAnimsObj, anim_44_values) + sizeof(gMarioAnims.anim_44_values) - offsetof(struct MarioAnimsObj, anim_44)},
+{offsetof(struct MarioAnimsObj, anim_45), offsetof(struct MarioAnimsObj, anim_45_46_values) + sizeof(gMarioAnims.anim_45_46_values) - offsetof(struct MarioAnimsObj, anim_45)},
+{offsetof(struct MarioAnimsObj, anim_46), offsetof(struct MarioAnimsObj, anim_45_46_values) + sizeof(gMarioAnims.anim_45_46_values) - offsetof(struct MarioAnimsObj, anim_46)},
+{offsetof(struct MarioAnimsObj, anim_47), offsetof(struct MarioAnimsObj, anim_47_values) + sizeof(gMarioAnims.anim_47_values) - offsetof(struct MarioAnimsObj, anim_47)},
+{offsetof(struct MarioAnimsObj, anim_48), offsetof(struct MarioAnimsObj, anim_48_values) + sizeof(gMarioAnims.anim_48_values) - offsetof(struct MarioAnimsObj, anim_48)},
+{offsetof(struct MarioAnimsObj, anim_49), offsetof(struct MarioAnimsObj, anim_49_values) + sizeof(gMarioAnims.anim_49_values) - offsetof(struct MarioAnimsObj, anim_49)},
+{offsetof(struct MarioAnimsObj, anim_4A), offsetof(struct MarioAnimsObj, anim_4A_values) + sizeof(gMarioAnims.anim_4A_values) - offsetof(struct MarioAnimsObj, anim_4A)},
+{offsetof(struct MarioAnimsObj, anim_4B), offsetof(struct MarioAnimsObj, anim_4B_values) + sizeof(gMarioAnims.anim_4B_values) - offsetof(struct MarioAnimsObj, anim_4B)},
+{offsetof(struct MarioAnimsObj, anim_4C), offsetof(struct MarioAnimsObj, anim_4C_values) + sizeof(gMarioAnims.anim_4C_values) - offsetof(struct MarioAnimsObj, anim_4C)},
+{offsetof(struct MarioAnimsObj, anim_4D), offsetof(struct MarioAnimsObj, anim_4D_4E_values) + sizeof(gMarioAnims.anim_4D_4E_values) - offsetof(struct MarioAnimsObj, anim_4D)},
+{offsetof(struct MarioAnimsObj, anim_4E), offsetof(struct MarioAnimsObj, anim_4D_4E_values) + sizeof(gMarioAnims.anim_4D_4E_values) - offsetof(struct MarioAnimsObj, anim_4E)},
+{offsetof(struct MarioAnimsObj, anim_4F), offsetof(struct MarioAnimsObj, anim_4F_values) + sizeof(gMarioAnims.anim_4F_values) - offsetof(struct MarioAnimsObj, anim_4F)},
+{offsetof(struct MarioAnimsObj, anim_50), offsetof(struct MarioAnimsObj, anim_50_values) + sizeof(gMarioAnims.anim_50_values) - offsetof(struct MarioAnimsObj, anim_50)},
+{offsetof(struct MarioAnimsObj, anim_51), offsetof(struct MarioAnimsObj, anim_51_values) + sizeof(gMarioAnims.anim_51_values) - offsetof(struct MarioAnimsObj, anim_51)},
+{offsetof(struct MarioAnimsObj, anim_52), offsetof(struct MarioAnimsObj, anim_52_values) + sizeof(gMarioAnims.anim_52_values) - offsetof(struct MarioAnimsObj, anim_52)},
+{offsetof(struct MarioAnimsObj, anim_53), offsetof(struct MarioAnimsObj, anim_53_values) + sizeof(gMarioAnims.anim_53_values) - offsetof(struct MarioAnimsObj, anim_53)},
+{offsetof(struct MarioAnimsObj, anim_54), offsetof(struct MarioAnimsObj, anim_54_values) + sizeof(gMarioAnims.anim_54_values) - offsetof(struct MarioAnimsObj, anim_54)},
+{offsetof(struct MarioAnimsObj, anim_55), offsetof(struct MarioAnimsObj, anim_55_values) + sizeof(gMarioAnims.anim_55_values) - offsetof(struct MarioAnimsObj, anim_55)},
+{offsetof(struct MarioAnimsObj, anim_56), offsetof(struct MarioAnimsObj, anim_56_57_values) + sizeof(gMarioAnims.anim_56_57_values) - offsetof(struct MarioAnimsObj, anim_56)},
+{offsetof(struct MarioAnimsObj, anim_57), offsetof(struct MarioAnimsObj, anim_56_57_values) + sizeof(gMarioAnims.anim_56_57_values) - offsetof(struct MarioAnimsObj, anim_57)},
+{offsetof(struct MarioAnimsObj, anim_58), offsetof(struct MarioAnimsObj, anim_58_values) + sizeof(gMarioAnims.anim_58_values) - offsetof(struct MarioAnimsObj, anim_58)},
+{offsetof(struct MarioAnimsObj, anim_59), offsetof(struct MarioAnimsObj, anim_59_values) + sizeof(gMarioAnims.anim_59_values) - offsetof(struct MarioAnimsObj, anim_59)},
+{offsetof(struct MarioAnimsObj, anim_5A), offsetof(struct MarioAnimsObj, anim_5A_values) + sizeof(gMarioAnims.anim_5A_values) - offsetof(struct MarioAnimsObj, anim_5A)},
+{offsetof(struct MarioAnimsObj, anim_5B), offsetof(struct MarioAnimsObj, anim_5B_values) + sizeof(gMarioAnims.anim_5B_values) - offsetof(struct MarioAnimsObj, anim_5B)},
+{offsetof(struct MarioAnimsObj, anim_5C), offsetof(struct MarioAnimsObj, anim_5C_values) + sizeof(gMarioAnims.anim_5C_values) - offsetof(struct MarioAnimsObj, anim_5C)},
+{offsetof(struct MarioAnimsObj, anim_5D), offsetof(struct MarioAnimsObj, anim_5D_values) + sizeof(gMarioAnims.anim_5D_values) - offsetof(struct MarioAnimsObj, anim_5D)},
+{offsetof(struct MarioAnimsObj, anim_5E), offsetof(struct MarioAnimsObj, anim_5E_values) + sizeof(gMarioAnims.anim_5E_values) - offsetof(struct MarioAnimsObj, anim_5E)},
+{offsetof(struct MarioAnimsObj, anim_5F), offsetof(struct MarioAnimsObj, anim_5F_values) + sizeof(gMarioAnims.anim_5F_values) - offsetof(struct MarioAnimsObj, anim_5F)},
+{offsetof(struct MarioAnimsObj, anim_60), offsetof(struct MarioAnimsObj, anim_60_values) + sizeof(gMarioAnims.anim_60_values) - offsetof(struct MarioAnimsObj, anim_60)},
+{offsetof(struct MarioAnimsObj, anim_61), offsetof(struct MarioAnimsObj, anim_61_values) + sizeof(gMarioAnims.anim_61_values) - offsetof(struct MarioAnimsObj, anim_61)},
+{offsetof(struct MarioAnimsObj, anim_62), offsetof(struct MarioAnimsObj, anim_62_values) + sizeof(gMarioAnims.anim_62_values) - offsetof(struct MarioAnimsObj, anim_62)},
+{offsetof(struct MarioAnimsObj, anim_63), offsetof(struct MarioAnimsObj, anim_63_values) + sizeof(gMarioAnims.anim_63_values) - offsetof(struct MarioAnimsObj, anim_63)},
+{offsetof(struct MarioAnimsObj, anim_64), offsetof(struct MarioAnimsObj, anim_64_values) + sizeof(gMarioAnims.anim_64_values) - offsetof(struct MarioAnimsObj, anim_64)},
+{offsetof(struct MarioAnimsObj, anim_65), offsetof(struct MarioAnimsObj, anim_65_values) + sizeof(gMarioAnims.anim_65_values) - offsetof(struct MarioAnimsObj, anim_65)},
+{offsetof(struct MarioAnimsObj, anim_66), offsetof(struct MarioAnimsObj, anim_66_values) + sizeof(gMarioAnims.anim_66_values) - offsetof(struct MarioAnimsObj, anim_66)},
+{offsetof(struct MarioAnimsObj, anim_67), offsetof(struct MarioAnimsObj, anim_67_values) + sizeof(gMarioAnims.anim_67_values) - offsetof(struct MarioAnimsObj, anim_67)},
+{offsetof(struct MarioAnimsObj, anim_68), offsetof(struct MarioAnimsObj, anim_68_values) + sizeof(gMarioAnims.anim_68_values) - offsetof(struct MarioAnimsObj, anim_68)},
+{offsetof(struct MarioAnimsObj, anim_69), offsetof(struct MarioAnimsObj, anim_69_values) + sizeof(gMarioAnims.anim_69_values) - offsetof(struct MarioAnimsObj, anim_69)},
+{offsetof(struct MarioAnimsObj, anim_6A), offsetof(struct MarioAnimsObj, anim_6A_values) + sizeof(gMarioAnims.anim_6A_values) - offsetof(struct MarioAnimsObj, anim_6A)},
+{offsetof(struct MarioAnimsObj, anim_6B), offsetof(struct MarioAnimsObj, anim_6B_values) + sizeof(gMarioAnims.anim_6B_values) - offsetof(struct MarioAnimsObj, anim_6B)},
+{offsetof(struct MarioAnimsObj, anim_6C), offsetof(struct MarioAnimsObj, anim_6C_values) + sizeof(gMarioAnims.anim_6C_values) - offsetof(struct MarioAnimsObj, anim_6C)},
+{offsetof(struct MarioAnimsObj, anim_6D), offsetof(struct MarioAnimsObj, anim_6D_values) + sizeof(gMarioAnims.anim_6D_values) - offsetof(struct MarioAnimsObj, anim_6D)},
+{offsetof(struct MarioAnimsObj, anim_6E), offsetof(struct MarioAnimsObj, anim_6E_values) + sizeof(gMarioAnims.anim_6E_values) - offsetof(struct MarioAnimsObj, anim_6E)},
+{offsetof(struct MarioAnimsObj, anim_6F), offsetof(struct MarioAnimsObj, anim_6F_70_values) + sizeof(gMarioAnims.anim_6F_70_values) - offsetof(struct MarioAnimsObj, anim_6F)},
+{offsetof(struct MarioAnimsObj, anim_70), offsetof(struct MarioAnimsObj, anim_6F_70_values) + sizeof(gMarioAnims.anim_6F_70_values) - offsetof(struct MarioAnimsObj, anim_70)},
+{offsetof(struct MarioAnimsObj, anim_71), offsetof(struct MarioAnimsObj, anim_71_values) + sizeof(gMarioAnims.anim_71_values) - offsetof(struct MarioAnimsObj, anim_71)},
+{offsetof(struct MarioAnimsObj, anim_72), offsetof(struct MarioAnimsObj, anim_72_73_values) + sizeof(gMarioAnims.anim_72_73_values) - offsetof(struct MarioAnimsObj, anim_72)},
+{offsetof(struct MarioAnimsObj, anim_73), offsetof(struct MarioAnimsObj, anim_72_73_values) + sizeof(gMarioAnims.anim_72_73_values) - offsetof(struct MarioAnimsObj, anim_73)},
+{offsetof(struct MarioAnimsObj, anim_74), offsetof(struct MarioAnimsObj, anim_74_values) + sizeof(gMarioAnims.anim_74_values) - offsetof(struct MarioAnimsObj, anim_74)},
+{offsetof(struct MarioAnimsObj, anim_75), offsetof(struct MarioAnimsObj, anim_75_values) + sizeof(gMarioAnims.anim_75_values) - offsetof(struct MarioAnimsObj, anim_75)},
+{offsetof(struct MarioAnimsObj, anim_76), offsetof(struct MarioAnimsObj, anim_76_values) + sizeof(gMarioAnims.anim_76_values) - offsetof(struct MarioAnimsObj, anim_76)},
+{offsetof(struct MarioAnimsObj, anim_77), offsetof(struct MarioAnimsObj, anim_77_values) + sizeof(gMarioAnims.anim_77_values) - offsetof(struct MarioAnimsObj, anim_77)},
+{offsetof(struct MarioAnimsObj, anim_78), offsetof(struct MarioAnimsObj, anim_78_values) + sizeof(gMarioAnims.anim_78_values) - offsetof(struct MarioAnimsObj, anim_78)},
+{offsetof(struct MarioAnimsObj, anim_79), offsetof(struct MarioAnimsObj, anim_79_values) + sizeof(gMarioAnims.anim_79_values) - offsetof(struct MarioAnimsObj, anim_79)},
+{offsetof(struct MarioAnimsObj, anim_7A), offsetof(struct MarioAnimsObj, anim_7A_values) + sizeof(gMarioAnims.anim_7A_values) - offsetof(struct MarioAnimsObj, anim_7A)},
+{offsetof(struct MarioAnimsObj, anim_7B), offsetof(struct MarioAnimsObj, anim_7B_values) + sizeof(gMarioAnims.anim_7B_values) - offsetof(struct MarioAnimsObj, anim_7B)},
+{offsetof(struct MarioAnimsObj, anim_7C), offsetof(struct MarioAnimsObj, anim_7C_values) + sizeof(gMarioAnims.anim_7C_values) - offsetof(struct MarioAnimsObj, anim_7C)},
+{offsetof(struct MarioAnimsObj, anim_7D), offsetof(struct MarioAnimsObj, anim_7D_values) + sizeof(gMarioAnims.anim_7D_values) - offsetof(struct MarioAnimsObj, anim_7D)},
+{offsetof(struct MarioAnimsObj, anim_7E), offsetof(struct MarioAnimsObj, anim_7E_values) + sizeof(gMarioAnims.anim_7E_values) - offsetof(struct MarioAnimsObj, anim_7E)},
+{offsetof(struct MarioAnimsObj, anim_7F), offsetof(struct MarioAnimsObj, anim_7F_values) + sizeof(gMarioAnims.anim_7F_values) - offsetof(struct MarioAnimsObj, anim_7F)},
+{offsetof(struct MarioAnimsObj, anim_80), offsetof(struct MarioAnimsObj, anim_80_values) + sizeof(gMarioAnims.anim_80_values) - offsetof(struct MarioAnimsObj, anim_80)},
+{offsetof(struct MarioAnimsObj, anim_81), offsetof(struct MarioAnimsObj, anim_81_values) + sizeof(gMarioAnims.anim_81_values) - offsetof(struct MarioAnimsObj, anim_81)},
+{offsetof(struct MarioAnimsObj, anim_82), offsetof(struct MarioAnimsObj, anim_82_values) + sizeof(gMarioAnims.anim_82_values) - offsetof(struct MarioAnimsObj, anim_82)},
+{offsetof(struct MarioAnimsObj, anim_83), offsetof(struct MarioAnimsObj, anim_83_values) + sizeof(gMarioAnims.anim_83_values) - offsetof(struct MarioAnimsObj, anim_83)},
+{offsetof(struct MarioAnimsObj, anim_84), offsetof(struct MarioAnimsObj, anim_84_values) + sizeof(gMarioAnims.anim_84_values) - offsetof(struct MarioAnimsObj, anim_84)},
+{offsetof(struct MarioAnimsObj, anim_85), offsetof(struct MarioAnimsObj, anim_85_values) + sizeof(gMarioAnims.anim_85_values) - offsetof(struct MarioAnimsObj, anim_85)},
+{offsetof(struct MarioAnimsObj, anim_86), offsetof(struct MarioAnimsObj, anim_86_values) + sizeof(gMarioAnims.anim_86_values) - offsetof(struct MarioAnimsObj, anim_86)},
+{offsetof(struct MarioAnimsObj, anim_87), offsetof(struct MarioAnimsObj, anim_87_values) + sizeof(gMarioAnims.anim_87_values) - offsetof(struct MarioAnimsObj, anim_87)},
+{offsetof(struct MarioAnimsObj, anim_88), offsetof(struct MarioAnimsObj, anim_88_89_values) + sizeof(gMarioAnims.anim_88_89_values) - offsetof(struct MarioAnimsObj, anim_88)},
+{offsetof(struct MarioAnimsObj, anim_89), offsetof(struct MarioAnimsObj, anim_88_89_values) + sizeof(gMarioAnims.anim_88_89_values) - offsetof(struct MarioAnimsObj, anim_89)},
+{offsetof(struct MarioAnimsObj, anim_8A), offsetof(struct MarioAnimsObj, anim_8A_values) + sizeof(gMarioAnims.anim_8A_values) - offsetof(struct MarioAnimsObj, anim_8A)},
+{offsetof(struct MarioAnimsObj, anim_8B), offsetof(struct MarioAnimsObj, anim_8B_values) + sizeof(gMarioAnims.anim_8B_values) - offsetof(struct MarioAnimsObj, anim_8B)},
+{offsetof(struct MarioAnimsObj, anim_8C), offsetof(struct MarioAnimsObj, anim_8C_values) + sizeof(gMarioAnims.anim_8C_values) - offsetof(struct MarioAnimsObj, anim_8C)},
+{offsetof(struct MarioAnimsObj, anim_8D), offsetof(struct MarioAnimsObj, anim_8D_values) + sizeof(gMarioAnims.anim_8D_values) - offsetof(struct MarioAnimsObj, anim_8D)},
+{offsetof(struct MarioAnimsObj, anim_8E), offsetof(struct MarioAnimsObj, anim_8E_8F_values) + sizeof(gMarioAnims.anim_8E_8F_values) - offsetof(struct MarioAnimsObj, anim_8E)},
+{offsetof(struct MarioAnimsObj, anim_8F), offsetof(struct MarioAnimsObj, anim_8E_8F_values) + sizeof(gMarioAnims.anim_8E_8F_values) - offsetof(struct MarioAnimsObj, anim_8F)},
+{offsetof(struct MarioAnimsObj, anim_90), offsetof(struct MarioAnimsObj, anim_90_values) + sizeof(gMarioAnims.anim_90_values) - offsetof(struct MarioAnimsObj, anim_90)},
+{offsetof(struct MarioAnimsObj, anim_91), offsetof(struct MarioAnimsObj, anim_91_values) + sizeof(gMarioAnims.anim_91_values) - offsetof(struct MarioAnimsObj, anim_91)},
+{offsetof(struct MarioAnimsObj, anim_92), offsetof(struct MarioAnimsObj, anim_92_values) + sizeof(gMarioAnims.anim_92_values) - offsetof(struct MarioAnimsObj, anim_92)},
+{offsetof(struct MarioAnimsObj, anim_93), offsetof(struct MarioAnimsObj, anim_93_values) + sizeof(gMarioAnims.anim_93_values) - offsetof(struct MarioAnimsObj, anim_93)},
+{offsetof(struct MarioAnimsObj, anim_94), offsetof(struct MarioAnimsObj, anim_94_values) + sizeof(gMarioAnims.anim_94_values) - offsetof(struct MarioAnimsObj, anim_94)},
+{offsetof(struct MarioAnimsObj, anim_95), offsetof(struct MarioAnimsObj, anim_95_values) + sizeof(gMarioAnims.anim_95_values) - offsetof(struct MarioAnimsObj, anim_95)},
+{offsetof(struct MarioAnimsObj, anim_96), offsetof(struct MarioAnimsObj, anim_96_values) + sizeof(gMarioAnims.anim_96_values) - offsetof(struct MarioAnimsObj, anim_96)},
+{offsetof(struct MarioAnimsObj, anim_97), offsetof(struct MarioAnimsObj, anim_97_values) + sizeof(gMarioAnims.anim_97_values) - offsetof(struct MarioAnimsObj, anim_97)},
+{offsetof(struct MarioAnimsObj, anim_98), offsetof(struct MarioAnimsObj, anim_98_values) + sizeof(gMarioAnims.anim_98_values) - offsetof(struct MarioAnimsObj, anim_98)},
+{offsetof(struct MarioAnimsObj, anim_99), offsetof(struct MarioAnimsObj, anim_99_values) + sizeof(gMarioAnims.anim_99_values) - offsetof(struct MarioAnimsObj, anim_99)},
+{offsetof(struct MarioAnimsObj, anim_9A), offsetof(struct MarioAnimsObj, anim_9A_values) + sizeof(gMarioAnims.anim_9A_values) - offsetof(struct MarioAnimsObj, anim_9A)},
+{offsetof(struct MarioAnimsObj, anim_9B), offsetof(struct MarioAnimsObj, anim_9B_values) + sizeof(gMarioAnims.anim_9B_values) - offsetof(struct MarioAnimsObj, anim_9B)},
+{offsetof(struct MarioAnimsObj, anim_9C), offsetof(struct MarioAnimsObj, anim_9C_values) + sizeof(gMarioAnims.anim_9C_values) - offsetof(struct MarioAnimsObj, anim_9C)},
+{offsetof(struct MarioAnimsObj, anim_9D), offsetof(struct MarioAnimsObj, anim_9D_values) + sizeof(gMarioAnims.anim_9D_values) - offsetof(struct MarioAnimsObj, anim_9D)},
+{offsetof(struct MarioAnimsObj, anim_9E), offsetof(struct MarioAnimsObj, anim_9E_values) + sizeof(gMarioAnims.anim_9E_values) - offsetof(struct MarioAnimsObj, anim_9E)},
+{offsetof(struct MarioAnimsObj, anim_9F), offsetof(struct MarioAnimsObj, anim_9F_values) + sizeof(gMarioAnims.anim_9F_values) - offsetof(struct MarioAnimsObj, anim_9F)},
+{offsetof(struct MarioAnimsObj, anim_A0), offsetof(struct MarioAnimsObj, anim_A0_values) + sizeof(gMarioAnims.anim_A0_values) - offsetof(struct MarioAnimsObj, anim_A0)},
+{offsetof(struct MarioAnimsObj, anim_A1), offsetof(struct MarioAnimsObj, anim_A1_values) + sizeof(gMarioAnims.anim_A1_values) - offsetof(struct MarioAnimsObj, anim_A1)},
+{offsetof(struct MarioAnimsObj, anim_A2), offsetof(struct MarioAnimsObj, anim_A2_values) + sizeof(gMarioAnims.anim_A2_values) - offsetof(struct MarioAnimsObj, anim_A2)},
+{offsetof(struct MarioAnimsObj, anim_A3), offsetof(struct MarioAnimsObj, anim_A3_values) + sizeof(gMarioAnims.anim_A3_values) - offsetof(struct MarioAnimsObj, anim_A3)},
+{offsetof(struct MarioAnimsObj, anim_A4), offsetof(struct MarioAnimsObj, anim_A4_values) + sizeof(gMarioAnims.anim_A4_values) - offsetof(struct MarioAnimsObj, anim_A4)},
+{offsetof(struct MarioAnimsObj, anim_A5), offsetof(struct MarioAnimsObj, anim_A5_values) + sizeof(gMarioAnims.anim_A5_values) - offsetof(struct MarioAnimsObj, anim_A5)},
+{offsetof(struct MarioAnimsObj, anim_A6), offsetof(struct MarioAnimsObj, anim_A6_values) + sizeof(gMarioAnims.anim_A6_values) - offsetof(struct MarioAnimsObj, anim_A6)},
+{offsetof(struct MarioAnimsObj, anim_A7), offsetof(struct MarioAnimsObj, anim_A7_values) + sizeof(gMarioAnims.anim_A7_values) - offsetof(struct MarioAnimsObj, anim_A7)},
+{offsetof(struct MarioAnimsObj, anim_A8), offsetof(struct MarioAnimsObj, anim_A8_values) + sizeof(gMarioAnims.anim_A8_values) - offsetof(struct MarioAnimsObj, anim_A8)},
+{offsetof(struct MarioAnimsObj, anim_A9), offsetof(struct MarioAnimsObj, anim_A9_values) + sizeof(gMarioAnims.anim_A9_values) - offsetof(struct MarioAnimsObj, anim_A9)},
+{offsetof(struct MarioAnimsObj, anim_AA), offsetof(struct MarioAnimsObj, anim_AA_values) + sizeof(gMarioAnims.anim_AA_values) - offsetof(struct MarioAnimsObj, anim_AA)},
+{offsetof(struct MarioAnimsObj, anim_AB), offsetof(struct MarioAnimsObj, anim_AB_values) + sizeof(gMarioAnims.anim_AB_values) - offsetof(struct MarioAnimsObj, anim_AB)},
+{offsetof(struct MarioAnimsObj, anim_AC), offsetof(struct MarioAnimsObj, anim_AC_values) + sizeof(gMarioAnims.anim_AC_values) - offsetof(struct MarioAnimsObj, anim_AC)},
+{offsetof(struct MarioAnimsObj, anim_AD), offsetof(struct MarioAnimsObj, anim_AD_values) + sizeof(gMarioAnims.anim_AD_values) - offsetof(struct MarioAnimsObj, anim_AD)},
+{offsetof(struct MarioAnimsObj, anim_AE), offsetof(struct MarioAnimsObj, anim_AE_values) + sizeof(gMarioAnims.anim_AE_values) - offsetof(struct MarioAnimsObj, anim_AE)},
+{offsetof(struct MarioAnimsObj, anim_AF), offsetof(struct MarioAnimsObj, anim_AF_values) + sizeof(gMarioAnims.anim_AF_values) - offsetof(struct MarioAnimsObj, anim_AF)},
+{offsetof(struct MarioAnimsObj, anim_B0), offsetof(struct MarioAnimsObj, anim_B0_values) + sizeof(gMarioAnims.anim_B0_values) - offsetof(struct MarioAnimsObj, anim_B0)},
+{offsetof(struct MarioAnimsObj, anim_B1), offsetof(struct MarioAnimsObj, anim_B1_values) + sizeof(gMarioAnims.anim_B1_values) - offsetof(struct MarioAnimsObj, anim_B1)},
+{offsetof(struct MarioAnimsObj, anim_B2), offsetof(struct MarioAnimsObj, anim_B2_values) + sizeof(gMarioAnims.anim_B2_values) - offsetof(struct MarioAnimsObj, anim_B2)},
+{offsetof(struct MarioAnimsObj, anim_B3), offsetof(struct MarioAnimsObj, anim_B3_values) + sizeof(gMarioAnims.anim_B3_values) - offsetof(struct MarioAnimsObj, anim_B3)},
+{offsetof(struct MarioAnimsObj, anim_B4), offsetof(struct MarioAnimsObj, anim_B4_values) + sizeof(gMarioAnims.anim_B4_values) - offsetof(struct MarioAnimsObj, anim_B4)},
+{offsetof(struct MarioAnimsObj, anim_B5), offsetof(struct MarioAnimsObj, anim_B5_B6_values) + sizeof(gMarioAnims.anim_B5_B6_values) - offsetof(struct MarioAnimsObj, anim_B5)},
+{offsetof(struct MarioAnimsObj, anim_B6), offsetof(struct MarioAnimsObj, anim_B5_B6_values) + sizeof(gMarioAnims.anim_B5_B6_values) - offsetof(struct MarioAnimsObj, anim_B6)},
+{offsetof(struct MarioAnimsObj, anim_B7), offsetof(struct MarioAnimsObj, anim_B7_values) + sizeof(gMarioAnims.anim_B7_values) - offsetof(struct MarioAnimsObj, anim_B7)},
+{offsetof(struct MarioAnimsObj, anim_B8), offsetof(struct MarioAnimsObj, anim_B8_values) + sizeof(gMarioAnims.anim_B8_values) - offsetof(struct MarioAnimsObj, anim_B8)},
+{offsetof(struct MarioAnimsObj, anim_B9), offsetof(struct MarioAnimsObj, anim_B9_values) + sizeof(gMarioAnims.anim_B9_values) - offsetof(struct MarioAnimsObj, anim_B9)},
+{offsetof(struct MarioAnimsObj, anim_BA), offsetof(struct MarioAnimsObj, anim_BA_values) + sizeof(gMarioAnims.anim_BA_values) - offsetof(struct MarioAnimsObj, anim_BA)},
+{offsetof(struct MarioAnimsObj, anim_BB), offsetof(struct MarioAnimsObj, anim_BB_values) + sizeof(gMarioAnims.anim_BB_values) - offsetof(struct MarioAnimsObj, anim_BB)},
+{offsetof(struct MarioAnimsObj, anim_BC), offsetof(struct MarioAnimsObj, anim_BC_BD_values) + sizeof(gMarioAnims.anim_BC_BD_values) - offsetof(struct MarioAnimsObj, anim_BC)},
+{offsetof(struct MarioAnimsObj, anim_BD), offsetof(struct MarioAnimsObj, anim_BC_BD_values) + sizeof(gMarioAnims.anim_BC_BD_values) - offsetof(struct MarioAnimsObj, anim_BD)},
+{offsetof(struct MarioAnimsObj, anim_BE), offsetof(struct MarioAnimsObj, anim_BE_values) + sizeof(gMarioAnims.anim_BE_values) - offsetof(struct MarioAnimsObj, anim_BE)},
+{offsetof(struct MarioAnimsObj, anim_BF), offsetof(struct MarioAnimsObj, anim_BF_values) + sizeof(gMarioAnims.anim_BF_values) - offsetof(struct MarioAnimsObj, anim_BF)},
+{offsetof(struct MarioAnimsObj, anim_C0), offsetof(struct MarioAnimsObj, anim_C0_values) + sizeof(gMarioAnims.anim_C0_values) - offsetof(struct MarioAnimsObj, anim_C0)},
+{offsetof(struct MarioAnimsObj, anim_C1), offsetof(struct MarioAnimsObj, anim_C1_values) + sizeof(gMarioAnims.anim_C1_values) - offsetof(struct MarioAnimsObj, anim_C1)},
+{offsetof(struct MarioAnimsObj, anim_C2), offsetof(struct MarioAnimsObj, anim_C2_values) + sizeof(gMarioAnims.anim_C2_values) - offsetof(struct MarioAnimsObj, anim_C2)},
+{offsetof(struct MarioAnimsObj, anim_C3), offsetof(struct MarioAnimsObj, anim_C3_values) + sizeof(gMarioAnims.anim_C3_values) - offsetof(struct MarioAnimsObj, anim_C3)},
+{offsetof(struct MarioAnimsObj, anim_C4), offsetof(struct MarioAnimsObj, anim_C4_values) + sizeof(gMarioAnims.anim_C4_values) - offsetof(struct MarioAnimsObj, anim_C4)},
+{offsetof(struct MarioAnimsObj, anim_C5), offsetof(struct MarioAnimsObj, anim_C5_values) + sizeof(gMarioAnims.anim_C5_values) - offsetof(struct MarioAnimsObj, anim_C5)},
+{offsetof(struct MarioAnimsObj, anim_C6), offsetof(struct MarioAnimsObj, anim_C6_values) + sizeof(gMarioAnims.anim_C6_values) - offsetof(struct MarioAnimsObj, anim_C6)},
+{offsetof(struct MarioAnimsObj, anim_C7), offsetof(struct MarioAnimsObj, anim_C7_values) + sizeof(gMarioAnims.anim_C7_values) - offsetof(struct MarioAnimsObj, anim_C7)},
+{offsetof(struct MarioAnimsObj, anim_C8), offsetof(struct MarioAnimsObj, anim_C8_values) + sizeof(gMarioAnims.anim_C8_values) - offsetof(struct MarioAnimsObj, anim_C8)},
+{offsetof(struct MarioAnimsObj, anim_C9), offsetof(struct MarioAnimsObj, anim_C9_values) + sizeof(gMarioAnims.anim_C9_values) - offsetof(struct MarioAnimsObj, anim_C9)},
+{offsetof(struct MarioAnimsObj, anim_CA), offsetof(struct MarioAnimsObj, anim_CA_values) + sizeof(gMarioAnims.anim_CA_values) - offsetof(struct MarioAnimsObj, anim_CA)},
+{offsetof(struct MarioAnimsObj, anim_CB), offsetof(struct MarioAnimsObj, anim_CB_CC_values) + sizeof(gMarioAnims.anim_CB_CC_values) - offsetof(struct MarioAnimsObj, anim_CB)},
+{offsetof(struct MarioAnimsObj, anim_CC), offsetof(struct MarioAnimsObj, anim_CB_CC_values) + sizeof(gMarioAnims.anim_CB_CC_values) - offsetof(struct MarioAnimsObj, anim_CC)},
+{offsetof(struct MarioAnimsObj, anim_CD), offsetof(struct MarioAnimsObj, anim_CD_values) + sizeof(gMarioAnims.anim_CD_values) - offsetof(struct MarioAnimsObj, anim_CD)},
+{offsetof(struct MarioAnimsObj, anim_CE), offsetof(struct MarioAnimsObj, anim_CE_values) + sizeof(gMarioAnims.anim_CE_values) - offsetof(struct MarioAnimsObj, anim_CE)},
+{offsetof(struct MarioAnimsObj, anim_CF), offsetof(struct MarioAnimsObj, anim_CF_values) + sizeof(gMarioAnims.anim_CF_values) - offsetof(struct MarioAnimsObj, anim_CF)},
+{offsetof(struct MarioAnimsObj, anim_D0), offsetof(struct MarioAnimsObj, anim_D0_values) + sizeof(gMarioAnims.anim_D0_values) - offsetof(struct MarioAnimsObj, anim_D0)},
+},
+{1, 189, 0, 0, 34, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_00_values) - offsetof(struct MarioAnimsObj, anim_00)), (u16 *)(offsetof(struct MarioAnimsObj, anim_00_indices) - offsetof(struct MarioAnimsObj, anim_00)), offsetof(struct MarioAnimsObj, anim_00_values) + sizeof(gMarioAnims.anim_00_values) - offsetof(struct MarioAnimsObj, anim_00), 1302, 126},
+{0},
+{0},
+{1, 189, 0, 0, 80, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_01_02_values) - offsetof(struct MarioAnimsObj, anim_01)), (u16 *)(offsetof(struct MarioAnimsObj, anim_01_02_indices) - offsetof(struct MarioAnimsObj, anim_01)), offsetof(struct MarioAnimsObj, anim_01_02_values) + sizeof(gMarioAnims.anim_01_02_values) - offsetof(struct MarioAnimsObj, anim_01), 3288, 126},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_01_02_values) - offsetof(struct MarioAnimsObj, anim_02)), (u16 *)(offsetof(struct MarioAnimsObj, anim_01_02_indices) - offsetof(struct MarioAnimsObj, anim_02)), offsetof(struct MarioAnimsObj, anim_01_02_values) + sizeof(gMarioAnims.anim_01_02_values) - offsetof(struct MarioAnimsObj, anim_02), 3288, 126},
+{0},
+{0},
+{1, 189, 0, 0, 64, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_03_values) - offsetof(struct MarioAnimsObj, anim_03)), (u16 *)(offsetof(struct MarioAnimsObj, anim_03_indices) - offsetof(struct MarioAnimsObj, anim_03)), offsetof(struct MarioAnimsObj, anim_03_values) + sizeof(gMarioAnims.anim_03_values) - offsetof(struct MarioAnimsObj, anim_03), 2186, 126},
+{0},
+{0},
+{1, 189, 0, 0, 33, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_04_values) - offsetof(struct MarioAnimsObj, anim_04)), (u16 *)(offsetof(struct MarioAnimsObj, anim_04_indices) - offsetof(struct MarioAnimsObj, anim_04)), offsetof(struct MarioAnimsObj, anim_04_values) + sizeof(gMarioAnims.anim_04_values) - offsetof(struct MarioAnimsObj, anim_04), 1132, 126},
+{0},
+{0},
+{0, 189, 0, 0, 90, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_05_values) - offsetof(struct MarioAnimsObj, anim_05)), (u16 *)(offsetof(struct MarioAnimsObj, anim_05_indices) - offsetof(struct MarioAnimsObj, anim_05)), offsetof(struct MarioAnimsObj, anim_05_values) + sizeof(gMarioAnims.anim_05_values) - offsetof(struct MarioAnimsObj, anim_05), 2898, 126},
+{0},
+{0},
+{1, 189, 0, 0, 12, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_06_values) - offsetof(struct MarioAnimsObj, anim_06)), (u16 *)(offsetof(struct MarioAnimsObj, anim_06_indices) - offsetof(struct MarioAnimsObj, anim_06)), offsetof(struct MarioAnimsObj, anim_06_values) + sizeof(gMarioAnims.anim_06_values) - offsetof(struct MarioAnimsObj, anim_06), 446, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_07_08_values) - offsetof(struct MarioAnimsObj, anim_07)), (u16 *)(offsetof(struct MarioAnimsObj, anim_07_08_indices) - offsetof(struct MarioAnimsObj, anim_07)), offsetof(struct MarioAnimsObj, anim_07_08_values) + sizeof(gMarioAnims.anim_07_08_values) - offsetof(struct MarioAnimsObj, anim_07), 734, 126},
+{1, 189, 1, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_07_08_values) - offsetof(struct MarioAnimsObj, anim_08)), (u16 *)(offsetof(struct MarioAnimsObj, anim_07_08_indices) - offsetof(struct MarioAnimsObj, anim_08)), offsetof(struct MarioAnimsObj, anim_07_08_values) + sizeof(gMarioAnims.anim_07_08_values) - offsetof(struct MarioAnimsObj, anim_08), 734, 126},
+{0},
+{0},
+{16, 189, 0, 0, 52, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_09_values) - offsetof(struct MarioAnimsObj, anim_09)), (u16 *)(offsetof(struct MarioAnimsObj, anim_09_indices) - offsetof(struct MarioAnimsObj, anim_09)), offsetof(struct MarioAnimsObj, anim_09_values) + sizeof(gMarioAnims.anim_09_values) - offsetof(struct MarioAnimsObj, anim_09), 1526, 126},
+{0},
+{0},
+{1, 189, 0, 0, 36, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0A_values) - offsetof(struct MarioAnimsObj, anim_0A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0A_indices) - offsetof(struct MarioAnimsObj, anim_0A)), offsetof(struct MarioAnimsObj, anim_0A_values) + sizeof(gMarioAnims.anim_0A_values) - offsetof(struct MarioAnimsObj, anim_0A), 1272, 126},
+{0},
+{0},
+{17, 189, 0, 0, 17, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0B_0C_values) - offsetof(struct MarioAnimsObj, anim_0B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0B_0C_indices) - offsetof(struct MarioAnimsObj, anim_0B)), offsetof(struct MarioAnimsObj, anim_0B_0C_values) + sizeof(gMarioAnims.anim_0B_0C_values) - offsetof(struct MarioAnimsObj, anim_0B), 674, 126},
+{19, 189, 16, 0, 17, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0B_0C_values) - offsetof(struct MarioAnimsObj, anim_0C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0B_0C_indices) - offsetof(struct MarioAnimsObj, anim_0C)), offsetof(struct MarioAnimsObj, anim_0B_0C_values) + sizeof(gMarioAnims.anim_0B_0C_values) - offsetof(struct MarioAnimsObj, anim_0C), 674, 126},
+{0},
+{0},
+{0, 189, 0, 0, 112, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0D_values) - offsetof(struct MarioAnimsObj, anim_0D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0D_indices) - offsetof(struct MarioAnimsObj, anim_0D)), offsetof(struct MarioAnimsObj, anim_0D_values) + sizeof(gMarioAnims.anim_0D_values) - offsetof(struct MarioAnimsObj, anim_0D), 385, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0E_values) - offsetof(struct MarioAnimsObj, anim_0E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0E_indices) - offsetof(struct MarioAnimsObj, anim_0E)), offsetof(struct MarioAnimsObj, anim_0E_values) + sizeof(gMarioAnims.anim_0E_values) - offsetof(struct MarioAnimsObj, anim_0E), 40, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0F_10_values) - offsetof(struct MarioAnimsObj, anim_0F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0F_10_indices) - offsetof(struct MarioAnimsObj, anim_0F)), offsetof(struct MarioAnimsObj, anim_0F_10_values) + sizeof(gMarioAnims.anim_0F_10_values) - offsetof(struct MarioAnimsObj, anim_0F), 751, 126},
+{1, 189, 1, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_0F_10_values) - offsetof(struct MarioAnimsObj, anim_10)), (u16 *)(offsetof(struct MarioAnimsObj, anim_0F_10_indices) - offsetof(struct MarioAnimsObj, anim_10)), offsetof(struct MarioAnimsObj, anim_0F_10_values) + sizeof(gMarioAnims.anim_0F_10_values) - offsetof(struct MarioAnimsObj, anim_10), 751, 126},
+{0},
+{0},
+{1, 189, 0, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_11_values) - offsetof(struct MarioAnimsObj, anim_11)), (u16 *)(offsetof(struct MarioAnimsObj, anim_11_indices) - offsetof(struct MarioAnimsObj, anim_11)), offsetof(struct MarioAnimsObj, anim_11_values) + sizeof(gMarioAnims.anim_11_values) - offsetof(struct MarioAnimsObj, anim_11), 587, 126},
+{0},
+{0},
+{1, 189, 0, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_12_values) - offsetof(struct MarioAnimsObj, anim_12)), (u16 *)(offsetof(struct MarioAnimsObj, anim_12_indices) - offsetof(struct MarioAnimsObj, anim_12)), offsetof(struct MarioAnimsObj, anim_12_values) + sizeof(gMarioAnims.anim_12_values) - offsetof(struct MarioAnimsObj, anim_12), 659, 126},
+{0},
+{0},
+{1, 189, 0, 0, 23, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_13_values) - offsetof(struct MarioAnimsObj, anim_13)), (u16 *)(offsetof(struct MarioAnimsObj, anim_13_indices) - offsetof(struct MarioAnimsObj, anim_13)), offsetof(struct MarioAnimsObj, anim_13_values) + sizeof(gMarioAnims.anim_13_values) - offsetof(struct MarioAnimsObj, anim_13), 839, 126},
+{0},
+{0},
+{1, 189, 0, 0, 15, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_14_values) - offsetof(struct MarioAnimsObj, anim_14)), (u16 *)(offsetof(struct MarioAnimsObj, anim_14_indices) - offsetof(struct MarioAnimsObj, anim_14)), offsetof(struct MarioAnimsObj, anim_14_values) + sizeof(gMarioAnims.anim_14_values) - offsetof(struct MarioAnimsObj, anim_14), 551, 126},
+{0},
+{0},
+{0, 189, 0, 0, 15, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_15_values) - offsetof(struct MarioAnimsObj, anim_15)), (u16 *)(offsetof(struct MarioAnimsObj, anim_15_indices) - offsetof(struct MarioAnimsObj, anim_15)), offsetof(struct MarioAnimsObj, anim_15_values) + sizeof(gMarioAnims.anim_15_values) - offsetof(struct MarioAnimsObj, anim_15), 465, 126},
+{0},
+{0},
+{0, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_16_values) - offsetof(struct MarioAnimsObj, anim_16)), (u16 *)(offsetof(struct MarioAnimsObj, anim_16_indices) - offsetof(struct MarioAnimsObj, anim_16)), offsetof(struct MarioAnimsObj, anim_16_values) + sizeof(gMarioAnims.anim_16_values) - offsetof(struct MarioAnimsObj, anim_16), 2226, 126},
+{0},
+{0},
+{0, 189, 0, 0, 76, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_17_values) - offsetof(struct MarioAnimsObj, anim_17)), (u16 *)(offsetof(struct MarioAnimsObj, anim_17_indices) - offsetof(struct MarioAnimsObj, anim_17)), offsetof(struct MarioAnimsObj, anim_17_values) + sizeof(gMarioAnims.anim_17_values) - offsetof(struct MarioAnimsObj, anim_17), 1471, 126},
+{0},
+{0},
+{0, 189, 42, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_18_values) - offsetof(struct MarioAnimsObj, anim_18)), (u16 *)(offsetof(struct MarioAnimsObj, anim_18_indices) - offsetof(struct MarioAnimsObj, anim_18)), offsetof(struct MarioAnimsObj, anim_18_values) + sizeof(gMarioAnims.anim_18_values) - offsetof(struct MarioAnimsObj, anim_18), 2226, 126},
+{0},
+{0},
+{1, 189, 0, 0, 86, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_19_values) - offsetof(struct MarioAnimsObj, anim_19)), (u16 *)(offsetof(struct MarioAnimsObj, anim_19_indices) - offsetof(struct MarioAnimsObj, anim_19)), offsetof(struct MarioAnimsObj, anim_19_values) + sizeof(gMarioAnims.anim_19_values) - offsetof(struct MarioAnimsObj, anim_19), 2677, 126},
+{0},
+{0},
+{1, 189, 0, 0, 17, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_1A_values) - offsetof(struct MarioAnimsObj, anim_1A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_1A_indices) - offsetof(struct MarioAnimsObj, anim_1A)), offsetof(struct MarioAnimsObj, anim_1A_values) + sizeof(gMarioAnims.anim_1A_values) - offsetof(struct MarioAnimsObj, anim_1A), 573, 126},
+{0},
+{0},
+{0, 189, 0, 0, 64, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_1B_values) - offsetof(struct MarioAnimsObj, anim_1B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_1B_indices) - offsetof(struct MarioAnimsObj, anim_1B)), offsetof(struct MarioAnimsObj, anim_1B_values) + sizeof(gMarioAnims.anim_1B_values) - offsetof(struct MarioAnimsObj, anim_1B), 1429, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_1C_values) - offsetof(struct MarioAnimsObj, anim_1C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_1C_indices) - offsetof(struct MarioAnimsObj, anim_1C)), offsetof(struct MarioAnimsObj, anim_1C_values) + sizeof(gMarioAnims.anim_1C_values) - offsetof(struct MarioAnimsObj, anim_1C), 390, 126},
+{0},
+{0},
+{0, 189, 0, 0, 35, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_1D_values) - offsetof(struct MarioAnimsObj, anim_1D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_1D_indices) - offsetof(struct MarioAnimsObj, anim_1D)), offsetof(struct MarioAnimsObj, anim_1D_values) + sizeof(gMarioAnims.anim_1D_values) - offsetof(struct MarioAnimsObj, anim_1D), 690, 126},
+{0},
+{0},
+{0, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_1E_values) - offsetof(struct MarioAnimsObj, anim_1E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_1E_indices) - offsetof(struct MarioAnimsObj, anim_1E)), offsetof(struct MarioAnimsObj, anim_1E_values) + sizeof(gMarioAnims.anim_1E_values) - offsetof(struct MarioAnimsObj, anim_1E), 765, 126},
+{0},
+{0},
+{1, 189, 0, 0, 21, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_1F_values) - offsetof(struct MarioAnimsObj, anim_1F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_1F_indices) - offsetof(struct MarioAnimsObj, anim_1F)), offsetof(struct MarioAnimsObj, anim_1F_values) + sizeof(gMarioAnims.anim_1F_values) - offsetof(struct MarioAnimsObj, anim_1F), 423, 126},
+{0},
+{0},
+{1, 189, 0, 0, 96, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_20_values) - offsetof(struct MarioAnimsObj, anim_20)), (u16 *)(offsetof(struct MarioAnimsObj, anim_20_indices) - offsetof(struct MarioAnimsObj, anim_20)), offsetof(struct MarioAnimsObj, anim_20_values) + sizeof(gMarioAnims.anim_20_values) - offsetof(struct MarioAnimsObj, anim_20), 3562, 126},
+{0},
+{0},
+{1, 189, 0, 0, 35, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_21_values) - offsetof(struct MarioAnimsObj, anim_21)), (u16 *)(offsetof(struct MarioAnimsObj, anim_21_indices) - offsetof(struct MarioAnimsObj, anim_21)), offsetof(struct MarioAnimsObj, anim_21_values) + sizeof(gMarioAnims.anim_21_values) - offsetof(struct MarioAnimsObj, anim_21), 1305, 126},
+{0},
+{0},
+{1, 189, 0, 0, 27, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_22_values) - offsetof(struct MarioAnimsObj, anim_22)), (u16 *)(offsetof(struct MarioAnimsObj, anim_22_indices) - offsetof(struct MarioAnimsObj, anim_22)), offsetof(struct MarioAnimsObj, anim_22_values) + sizeof(gMarioAnims.anim_22_values) - offsetof(struct MarioAnimsObj, anim_22), 875, 126},
+{0},
+{0},
+{1, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_23_values) - offsetof(struct MarioAnimsObj, anim_23)), (u16 *)(offsetof(struct MarioAnimsObj, anim_23_indices) - offsetof(struct MarioAnimsObj, anim_23)), offsetof(struct MarioAnimsObj, anim_23_values) + sizeof(gMarioAnims.anim_23_values) - offsetof(struct MarioAnimsObj, anim_23), 4108, 126},
+{0},
+{0},
+{1, 189, 0, 0, 120, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_24_values) - offsetof(struct MarioAnimsObj, anim_24)), (u16 *)(offsetof(struct MarioAnimsObj, anim_24_indices) - offsetof(struct MarioAnimsObj, anim_24)), offsetof(struct MarioAnimsObj, anim_24_values) + sizeof(gMarioAnims.anim_24_values) - offsetof(struct MarioAnimsObj, anim_24), 4688, 126},
+{0},
+{0},
+{65, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_25_values) - offsetof(struct MarioAnimsObj, anim_25)), (u16 *)(offsetof(struct MarioAnimsObj, anim_25_indices) - offsetof(struct MarioAnimsObj, anim_25)), offsetof(struct MarioAnimsObj, anim_25_values) + sizeof(gMarioAnims.anim_25_values) - offsetof(struct MarioAnimsObj, anim_25), 4009, 126},
+{0},
+{0},
+{65, 189, 0, 0, 94, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_26_values) - offsetof(struct MarioAnimsObj, anim_26)), (u16 *)(offsetof(struct MarioAnimsObj, anim_26_indices) - offsetof(struct MarioAnimsObj, anim_26)), offsetof(struct MarioAnimsObj, anim_26_values) + sizeof(gMarioAnims.anim_26_values) - offsetof(struct MarioAnimsObj, anim_26), 3676, 126},
+{0},
+{0},
+{1, 189, 0, 0, 112, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_27_values) - offsetof(struct MarioAnimsObj, anim_27)), (u16 *)(offsetof(struct MarioAnimsObj, anim_27_indices) - offsetof(struct MarioAnimsObj, anim_27)), offsetof(struct MarioAnimsObj, anim_27_values) + sizeof(gMarioAnims.anim_27_values) - offsetof(struct MarioAnimsObj, anim_27), 4490, 126},
+{0},
+{0},
+{1, 189, 0, 0, 15, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_28_values) - offsetof(struct MarioAnimsObj, anim_28)), (u16 *)(offsetof(struct MarioAnimsObj, anim_28_indices) - offsetof(struct MarioAnimsObj, anim_28)), offsetof(struct MarioAnimsObj, anim_28_values) + sizeof(gMarioAnims.anim_28_values) - offsetof(struct MarioAnimsObj, anim_28), 505, 126},
+{0},
+{0},
+{0, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_29_values) - offsetof(struct MarioAnimsObj, anim_29)), (u16 *)(offsetof(struct MarioAnimsObj, anim_29_indices) - offsetof(struct MarioAnimsObj, anim_29)), offsetof(struct MarioAnimsObj, anim_29_values) + sizeof(gMarioAnims.anim_29_values) - offsetof(struct MarioAnimsObj, anim_29), 291, 126},
+{0},
+{0},
+{0, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_2A_values) - offsetof(struct MarioAnimsObj, anim_2A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_2A_indices) - offsetof(struct MarioAnimsObj, anim_2A)), offsetof(struct MarioAnimsObj, anim_2A_values) + sizeof(gMarioAnims.anim_2A_values) - offsetof(struct MarioAnimsObj, anim_2A), 626, 126},
+{0},
+{0},
+{0, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_2B_values) - offsetof(struct MarioAnimsObj, anim_2B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_2B_indices) - offsetof(struct MarioAnimsObj, anim_2B)), offsetof(struct MarioAnimsObj, anim_2B_values) + sizeof(gMarioAnims.anim_2B_values) - offsetof(struct MarioAnimsObj, anim_2B), 791, 126},
+{0},
+{0},
+{1, 189, 0, 0, 80, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_2C_2D_values) - offsetof(struct MarioAnimsObj, anim_2C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_2C_2D_indices) - offsetof(struct MarioAnimsObj, anim_2C)), offsetof(struct MarioAnimsObj, anim_2C_2D_values) + sizeof(gMarioAnims.anim_2C_2D_values) - offsetof(struct MarioAnimsObj, anim_2C), 2810, 126},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_2C_2D_values) - offsetof(struct MarioAnimsObj, anim_2D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_2C_2D_indices) - offsetof(struct MarioAnimsObj, anim_2D)), offsetof(struct MarioAnimsObj, anim_2C_2D_values) + sizeof(gMarioAnims.anim_2C_2D_values) - offsetof(struct MarioAnimsObj, anim_2D), 2810, 126},
+{0},
+{0},
+{1, 189, 0, 0, 47, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_2E_values) - offsetof(struct MarioAnimsObj, anim_2E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_2E_indices) - offsetof(struct MarioAnimsObj, anim_2E)), offsetof(struct MarioAnimsObj, anim_2E_values) + sizeof(gMarioAnims.anim_2E_values) - offsetof(struct MarioAnimsObj, anim_2E), 1514, 126},
+{0},
+{0},
+{1, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_2F_values) - offsetof(struct MarioAnimsObj, anim_2F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_2F_indices) - offsetof(struct MarioAnimsObj, anim_2F)), offsetof(struct MarioAnimsObj, anim_2F_values) + sizeof(gMarioAnims.anim_2F_values) - offsetof(struct MarioAnimsObj, anim_2F), 3710, 126},
+{0},
+{0},
+{0, 189, 0, 0, 90, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_30_values) - offsetof(struct MarioAnimsObj, anim_30)), (u16 *)(offsetof(struct MarioAnimsObj, anim_30_indices) - offsetof(struct MarioAnimsObj, anim_30)), offsetof(struct MarioAnimsObj, anim_30_values) + sizeof(gMarioAnims.anim_30_values) - offsetof(struct MarioAnimsObj, anim_30), 2714, 126},
+{0},
+{0},
+{1, 189, 0, 0, 140, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_31_values) - offsetof(struct MarioAnimsObj, anim_31)), (u16 *)(offsetof(struct MarioAnimsObj, anim_31_indices) - offsetof(struct MarioAnimsObj, anim_31)), offsetof(struct MarioAnimsObj, anim_31_values) + sizeof(gMarioAnims.anim_31_values) - offsetof(struct MarioAnimsObj, anim_31), 5330, 126},
+{0},
+{0},
+{1, 189, 0, 0, 96, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_32_values) - offsetof(struct MarioAnimsObj, anim_32)), (u16 *)(offsetof(struct MarioAnimsObj, anim_32_indices) - offsetof(struct MarioAnimsObj, anim_32)), offsetof(struct MarioAnimsObj, anim_32_values) + sizeof(gMarioAnims.anim_32_values) - offsetof(struct MarioAnimsObj, anim_32), 3945, 126},
+{0},
+{0},
+{0, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_33_values) - offsetof(struct MarioAnimsObj, anim_33)), (u16 *)(offsetof(struct MarioAnimsObj, anim_33_indices) - offsetof(struct MarioAnimsObj, anim_33)), offsetof(struct MarioAnimsObj, anim_33_values) + sizeof(gMarioAnims.anim_33_values) - offsetof(struct MarioAnimsObj, anim_33), 1420, 126},
+{0},
+{0},
+{1, 189, 0, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_34_values) - offsetof(struct MarioAnimsObj, anim_34)), (u16 *)(offsetof(struct MarioAnimsObj, anim_34_indices) - offsetof(struct MarioAnimsObj, anim_34)), offsetof(struct MarioAnimsObj, anim_34_values) + sizeof(gMarioAnims.anim_34_values) - offsetof(struct MarioAnimsObj, anim_34), 650, 126},
+{0},
+{0},
+{1, 189, 0, 0, 54, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_35_values) - offsetof(struct MarioAnimsObj, anim_35)), (u16 *)(offsetof(struct MarioAnimsObj, anim_35_indices) - offsetof(struct MarioAnimsObj, anim_35)), offsetof(struct MarioAnimsObj, anim_35_values) + sizeof(gMarioAnims.anim_35_values) - offsetof(struct MarioAnimsObj, anim_35), 1852, 126},
+{0},
+{0},
+{1, 189, 10, 0, 46, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_36_values) - offsetof(struct MarioAnimsObj, anim_36)), (u16 *)(offsetof(struct MarioAnimsObj, anim_36_indices) - offsetof(struct MarioAnimsObj, anim_36)), offsetof(struct MarioAnimsObj, anim_36_values) + sizeof(gMarioAnims.anim_36_values) - offsetof(struct MarioAnimsObj, anim_36), 1850, 126},
+{0},
+{0},
+{1, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_37_values) - offsetof(struct MarioAnimsObj, anim_37)), (u16 *)(offsetof(struct MarioAnimsObj, anim_37_indices) - offsetof(struct MarioAnimsObj, anim_37)), offsetof(struct MarioAnimsObj, anim_37_values) + sizeof(gMarioAnims.anim_37_values) - offsetof(struct MarioAnimsObj, anim_37), 3414, 126},
+{0},
+{0},
+{1, 189, 0, 0, 12, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_38_values) - offsetof(struct MarioAnimsObj, anim_38)), (u16 *)(offsetof(struct MarioAnimsObj, anim_38_indices) - offsetof(struct MarioAnimsObj, anim_38)), offsetof(struct MarioAnimsObj, anim_38_values) + sizeof(gMarioAnims.anim_38_values) - offsetof(struct MarioAnimsObj, anim_38), 422, 126},
+{0},
+{0},
+{1, 189, 0, 0, 155, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_39_values) - offsetof(struct MarioAnimsObj, anim_39)), (u16 *)(offsetof(struct MarioAnimsObj, anim_39_indices) - offsetof(struct MarioAnimsObj, anim_39)), offsetof(struct MarioAnimsObj, anim_39_values) + sizeof(gMarioAnims.anim_39_values) - offsetof(struct MarioAnimsObj, anim_39), 6209, 126},
+{0},
+{0},
+{1, 189, 0, 0, 6, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_3A_values) - offsetof(struct MarioAnimsObj, anim_3A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_3A_indices) - offsetof(struct MarioAnimsObj, anim_3A)), offsetof(struct MarioAnimsObj, anim_3A_values) + sizeof(gMarioAnims.anim_3A_values) - offsetof(struct MarioAnimsObj, anim_3A), 187, 126},
+{0},
+{0},
+{1, 189, 0, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_3B_values) - offsetof(struct MarioAnimsObj, anim_3B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_3B_indices) - offsetof(struct MarioAnimsObj, anim_3B)), offsetof(struct MarioAnimsObj, anim_3B_values) + sizeof(gMarioAnims.anim_3B_values) - offsetof(struct MarioAnimsObj, anim_3B), 602, 126},
+{0},
+{0},
+{1, 189, 0, 0, 11, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_3C_3D_values) - offsetof(struct MarioAnimsObj, anim_3C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_3C_3D_indices) - offsetof(struct MarioAnimsObj, anim_3C)), offsetof(struct MarioAnimsObj, anim_3C_3D_values) + sizeof(gMarioAnims.anim_3C_3D_values) - offsetof(struct MarioAnimsObj, anim_3C), 387, 126},
+{1, 189, 10, 0, 11, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_3C_3D_values) - offsetof(struct MarioAnimsObj, anim_3D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_3C_3D_indices) - offsetof(struct MarioAnimsObj, anim_3D)), offsetof(struct MarioAnimsObj, anim_3C_3D_values) + sizeof(gMarioAnims.anim_3C_3D_values) - offsetof(struct MarioAnimsObj, anim_3D), 387, 126},
+{0},
+{0},
+{1, 189, 0, 0, 155, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_3E_values) - offsetof(struct MarioAnimsObj, anim_3E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_3E_indices) - offsetof(struct MarioAnimsObj, anim_3E)), offsetof(struct MarioAnimsObj, anim_3E_values) + sizeof(gMarioAnims.anim_3E_values) - offsetof(struct MarioAnimsObj, anim_3E), 5745, 126},
+{0},
+{0},
+{0, 189, 0, 0, 61, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_3F_values) - offsetof(struct MarioAnimsObj, anim_3F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_3F_indices) - offsetof(struct MarioAnimsObj, anim_3F)), offsetof(struct MarioAnimsObj, anim_3F_values) + sizeof(gMarioAnims.anim_3F_values) - offsetof(struct MarioAnimsObj, anim_3F), 1547, 126},
+{0},
+{0},
+{1, 189, 0, 0, 19, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_40_values) - offsetof(struct MarioAnimsObj, anim_40)), (u16 *)(offsetof(struct MarioAnimsObj, anim_40_indices) - offsetof(struct MarioAnimsObj, anim_40)), offsetof(struct MarioAnimsObj, anim_40_values) + sizeof(gMarioAnims.anim_40_values) - offsetof(struct MarioAnimsObj, anim_40), 547, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_41_values) - offsetof(struct MarioAnimsObj, anim_41)), (u16 *)(offsetof(struct MarioAnimsObj, anim_41_indices) - offsetof(struct MarioAnimsObj, anim_41)), offsetof(struct MarioAnimsObj, anim_41_values) + sizeof(gMarioAnims.anim_41_values) - offsetof(struct MarioAnimsObj, anim_41), 268, 126},
+{0},
+{0},
+{1, 189, 2, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_42_values) - offsetof(struct MarioAnimsObj, anim_42)), (u16 *)(offsetof(struct MarioAnimsObj, anim_42_indices) - offsetof(struct MarioAnimsObj, anim_42)), offsetof(struct MarioAnimsObj, anim_42_values) + sizeof(gMarioAnims.anim_42_values) - offsetof(struct MarioAnimsObj, anim_42), 478, 126},
+{0},
+{0},
+{1, 189, 0, 0, 2, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_43_values) - offsetof(struct MarioAnimsObj, anim_43)), (u16 *)(offsetof(struct MarioAnimsObj, anim_43_indices) - offsetof(struct MarioAnimsObj, anim_43)), offsetof(struct MarioAnimsObj, anim_43_values) + sizeof(gMarioAnims.anim_43_values) - offsetof(struct MarioAnimsObj, anim_43), 42, 126},
+{0},
+{0},
+{1, 189, 0, 0, 15, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_44_values) - offsetof(struct MarioAnimsObj, anim_44)), (u16 *)(offsetof(struct MarioAnimsObj, anim_44_indices) - offsetof(struct MarioAnimsObj, anim_44)), offsetof(struct MarioAnimsObj, anim_44_values) + sizeof(gMarioAnims.anim_44_values) - offsetof(struct MarioAnimsObj, anim_44), 325, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_45_46_values) - offsetof(struct MarioAnimsObj, anim_45)), (u16 *)(offsetof(struct MarioAnimsObj, anim_45_46_indices) - offsetof(struct MarioAnimsObj, anim_45)), offsetof(struct MarioAnimsObj, anim_45_46_values) + sizeof(gMarioAnims.anim_45_46_values) - offsetof(struct MarioAnimsObj, anim_45), 595, 126},
+{1, 189, 1, 0, 14, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_45_46_values) - offsetof(struct MarioAnimsObj, anim_46)), (u16 *)(offsetof(struct MarioAnimsObj, anim_45_46_indices) - offsetof(struct MarioAnimsObj, anim_46)), offsetof(struct MarioAnimsObj, anim_45_46_values) + sizeof(gMarioAnims.anim_45_46_values) - offsetof(struct MarioAnimsObj, anim_46), 595, 126},
+{0},
+{0},
+{1, 189, 0, 0, 11, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_47_values) - offsetof(struct MarioAnimsObj, anim_47)), (u16 *)(offsetof(struct MarioAnimsObj, anim_47_indices) - offsetof(struct MarioAnimsObj, anim_47)), offsetof(struct MarioAnimsObj, anim_47_values) + sizeof(gMarioAnims.anim_47_values) - offsetof(struct MarioAnimsObj, anim_47), 419, 126},
+{0},
+{0},
+{0, 189, 0, 0, 77, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_48_values) - offsetof(struct MarioAnimsObj, anim_48)), (u16 *)(offsetof(struct MarioAnimsObj, anim_48_indices) - offsetof(struct MarioAnimsObj, anim_48)), offsetof(struct MarioAnimsObj, anim_48_values) + sizeof(gMarioAnims.anim_48_values) - offsetof(struct MarioAnimsObj, anim_48), 2549, 126},
+{0},
+{0},
+{1, 189, 0, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_49_values) - offsetof(struct MarioAnimsObj, anim_49)), (u16 *)(offsetof(struct MarioAnimsObj, anim_49_indices) - offsetof(struct MarioAnimsObj, anim_49)), offsetof(struct MarioAnimsObj, anim_49_values) + sizeof(gMarioAnims.anim_49_values) - offsetof(struct MarioAnimsObj, anim_49), 649, 126},
+{0},
+{0},
+{1, 189, 0, 0, 8, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_4A_values) - offsetof(struct MarioAnimsObj, anim_4A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_4A_indices) - offsetof(struct MarioAnimsObj, anim_4A)), offsetof(struct MarioAnimsObj, anim_4A_values) + sizeof(gMarioAnims.anim_4A_values) - offsetof(struct MarioAnimsObj, anim_4A), 308, 126},
+{0},
+{0},
+{1, 189, 0, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_4B_values) - offsetof(struct MarioAnimsObj, anim_4B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_4B_indices) - offsetof(struct MarioAnimsObj, anim_4B)), offsetof(struct MarioAnimsObj, anim_4B_values) + sizeof(gMarioAnims.anim_4B_values) - offsetof(struct MarioAnimsObj, anim_4B), 693, 126},
+{0},
+{0},
+{1, 189, 0, 0, 9, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_4C_values) - offsetof(struct MarioAnimsObj, anim_4C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_4C_indices) - offsetof(struct MarioAnimsObj, anim_4C)), offsetof(struct MarioAnimsObj, anim_4C_values) + sizeof(gMarioAnims.anim_4C_values) - offsetof(struct MarioAnimsObj, anim_4C), 335, 126},
+{0},
+{0},
+{1, 189, 0, 0, 12, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_4D_4E_values) - offsetof(struct MarioAnimsObj, anim_4D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_4D_4E_indices) - offsetof(struct MarioAnimsObj, anim_4D)), offsetof(struct MarioAnimsObj, anim_4D_4E_values) + sizeof(gMarioAnims.anim_4D_4E_values) - offsetof(struct MarioAnimsObj, anim_4D), 1228, 126},
+{1, 189, 22, 0, 38, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_4D_4E_values) - offsetof(struct MarioAnimsObj, anim_4E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_4D_4E_indices) - offsetof(struct MarioAnimsObj, anim_4E)), offsetof(struct MarioAnimsObj, anim_4D_4E_values) + sizeof(gMarioAnims.anim_4D_4E_values) - offsetof(struct MarioAnimsObj, anim_4E), 1228, 126},
+{0},
+{0},
+{1, 189, 0, 0, 21, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_4F_values) - offsetof(struct MarioAnimsObj, anim_4F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_4F_indices) - offsetof(struct MarioAnimsObj, anim_4F)), offsetof(struct MarioAnimsObj, anim_4F_values) + sizeof(gMarioAnims.anim_4F_values) - offsetof(struct MarioAnimsObj, anim_4F), 789, 126},
+{0},
+{0},
+{1, 189, 0, 0, 6, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_50_values) - offsetof(struct MarioAnimsObj, anim_50)), (u16 *)(offsetof(struct MarioAnimsObj, anim_50_indices) - offsetof(struct MarioAnimsObj, anim_50)), offsetof(struct MarioAnimsObj, anim_50_values) + sizeof(gMarioAnims.anim_50_values) - offsetof(struct MarioAnimsObj, anim_50), 210, 126},
+{0},
+{0},
+{1, 189, 0, 0, 14, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_51_values) - offsetof(struct MarioAnimsObj, anim_51)), (u16 *)(offsetof(struct MarioAnimsObj, anim_51_indices) - offsetof(struct MarioAnimsObj, anim_51)), offsetof(struct MarioAnimsObj, anim_51_values) + sizeof(gMarioAnims.anim_51_values) - offsetof(struct MarioAnimsObj, anim_51), 501, 126},
+{0},
+{0},
+{1, 189, 0, 0, 11, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_52_values) - offsetof(struct MarioAnimsObj, anim_52)), (u16 *)(offsetof(struct MarioAnimsObj, anim_52_indices) - offsetof(struct MarioAnimsObj, anim_52)), offsetof(struct MarioAnimsObj, anim_52_values) + sizeof(gMarioAnims.anim_52_values) - offsetof(struct MarioAnimsObj, anim_52), 439, 126},
+{0},
+{0},
+{1, 189, 0, 0, 25, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_53_values) - offsetof(struct MarioAnimsObj, anim_53)), (u16 *)(offsetof(struct MarioAnimsObj, anim_53_indices) - offsetof(struct MarioAnimsObj, anim_53)), offsetof(struct MarioAnimsObj, anim_53_values) + sizeof(gMarioAnims.anim_53_values) - offsetof(struct MarioAnimsObj, anim_53), 985, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_54_values) - offsetof(struct MarioAnimsObj, anim_54)), (u16 *)(offsetof(struct MarioAnimsObj, anim_54_indices) - offsetof(struct MarioAnimsObj, anim_54)), offsetof(struct MarioAnimsObj, anim_54_values) + sizeof(gMarioAnims.anim_54_values) - offsetof(struct MarioAnimsObj, anim_54), 657, 126},
+{0},
+{0},
+{1, 189, 0, 0, 152, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_55_values) - offsetof(struct MarioAnimsObj, anim_55)), (u16 *)(offsetof(struct MarioAnimsObj, anim_55_indices) - offsetof(struct MarioAnimsObj, anim_55)), offsetof(struct MarioAnimsObj, anim_55_values) + sizeof(gMarioAnims.anim_55_values) - offsetof(struct MarioAnimsObj, anim_55), 5634, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_56_57_values) - offsetof(struct MarioAnimsObj, anim_56)), (u16 *)(offsetof(struct MarioAnimsObj, anim_56_57_indices) - offsetof(struct MarioAnimsObj, anim_56)), offsetof(struct MarioAnimsObj, anim_56_57_values) + sizeof(gMarioAnims.anim_56_57_values) - offsetof(struct MarioAnimsObj, anim_56), 780, 126},
+{1, 189, 9, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_56_57_values) - offsetof(struct MarioAnimsObj, anim_57)), (u16 *)(offsetof(struct MarioAnimsObj, anim_56_57_indices) - offsetof(struct MarioAnimsObj, anim_57)), offsetof(struct MarioAnimsObj, anim_56_57_values) + sizeof(gMarioAnims.anim_56_57_values) - offsetof(struct MarioAnimsObj, anim_57), 780, 126},
+{0},
+{0},
+{0, 189, 0, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_58_values) - offsetof(struct MarioAnimsObj, anim_58)), (u16 *)(offsetof(struct MarioAnimsObj, anim_58_indices) - offsetof(struct MarioAnimsObj, anim_58)), offsetof(struct MarioAnimsObj, anim_58_values) + sizeof(gMarioAnims.anim_58_values) - offsetof(struct MarioAnimsObj, anim_58), 541, 126},
+{0},
+{0},
+{1, 189, 0, 0, 37, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_59_values) - offsetof(struct MarioAnimsObj, anim_59)), (u16 *)(offsetof(struct MarioAnimsObj, anim_59_indices) - offsetof(struct MarioAnimsObj, anim_59)), offsetof(struct MarioAnimsObj, anim_59_values) + sizeof(gMarioAnims.anim_59_values) - offsetof(struct MarioAnimsObj, anim_59), 1526, 126},
+{0},
+{0},
+{1, 189, 0, 0, 38, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_5A_values) - offsetof(struct MarioAnimsObj, anim_5A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_5A_indices) - offsetof(struct MarioAnimsObj, anim_5A)), offsetof(struct MarioAnimsObj, anim_5A_values) + sizeof(gMarioAnims.anim_5A_values) - offsetof(struct MarioAnimsObj, anim_5A), 1639, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_5B_values) - offsetof(struct MarioAnimsObj, anim_5B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_5B_indices) - offsetof(struct MarioAnimsObj, anim_5B)), offsetof(struct MarioAnimsObj, anim_5B_values) + sizeof(gMarioAnims.anim_5B_values) - offsetof(struct MarioAnimsObj, anim_5B), 360, 126},
+{0},
+{0},
+{1, 189, 0, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_5C_values) - offsetof(struct MarioAnimsObj, anim_5C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_5C_indices) - offsetof(struct MarioAnimsObj, anim_5C)), offsetof(struct MarioAnimsObj, anim_5C_values) + sizeof(gMarioAnims.anim_5C_values) - offsetof(struct MarioAnimsObj, anim_5C), 629, 126},
+{0},
+{0},
+{1, 189, 0, 0, 19, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_5D_values) - offsetof(struct MarioAnimsObj, anim_5D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_5D_indices) - offsetof(struct MarioAnimsObj, anim_5D)), offsetof(struct MarioAnimsObj, anim_5D_values) + sizeof(gMarioAnims.anim_5D_values) - offsetof(struct MarioAnimsObj, anim_5D), 571, 126},
+{0},
+{0},
+{1, 189, 0, 0, 155, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_5E_values) - offsetof(struct MarioAnimsObj, anim_5E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_5E_indices) - offsetof(struct MarioAnimsObj, anim_5E)), offsetof(struct MarioAnimsObj, anim_5E_values) + sizeof(gMarioAnims.anim_5E_values) - offsetof(struct MarioAnimsObj, anim_5E), 6055, 126},
+{0},
+{0},
+{9, 189, 0, 0, 60, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_5F_values) - offsetof(struct MarioAnimsObj, anim_5F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_5F_indices) - offsetof(struct MarioAnimsObj, anim_5F)), offsetof(struct MarioAnimsObj, anim_5F_values) + sizeof(gMarioAnims.anim_5F_values) - offsetof(struct MarioAnimsObj, anim_5F), 2529, 126},
+{0},
+{0},
+{9, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_60_values) - offsetof(struct MarioAnimsObj, anim_60)), (u16 *)(offsetof(struct MarioAnimsObj, anim_60_indices) - offsetof(struct MarioAnimsObj, anim_60)), offsetof(struct MarioAnimsObj, anim_60_values) + sizeof(gMarioAnims.anim_60_values) - offsetof(struct MarioAnimsObj, anim_60), 2010, 126},
+{0},
+{0},
+{9, 189, 0, 0, 147, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_61_values) - offsetof(struct MarioAnimsObj, anim_61)), (u16 *)(offsetof(struct MarioAnimsObj, anim_61_indices) - offsetof(struct MarioAnimsObj, anim_61)), offsetof(struct MarioAnimsObj, anim_61_values) + sizeof(gMarioAnims.anim_61_values) - offsetof(struct MarioAnimsObj, anim_61), 6330, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_62_values) - offsetof(struct MarioAnimsObj, anim_62)), (u16 *)(offsetof(struct MarioAnimsObj, anim_62_indices) - offsetof(struct MarioAnimsObj, anim_62)), offsetof(struct MarioAnimsObj, anim_62_values) + sizeof(gMarioAnims.anim_62_values) - offsetof(struct MarioAnimsObj, anim_62), 371, 126},
+{0},
+{0},
+{0, 189, 0, 0, 33, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_63_values) - offsetof(struct MarioAnimsObj, anim_63)), (u16 *)(offsetof(struct MarioAnimsObj, anim_63_indices) - offsetof(struct MarioAnimsObj, anim_63)), offsetof(struct MarioAnimsObj, anim_63_values) + sizeof(gMarioAnims.anim_63_values) - offsetof(struct MarioAnimsObj, anim_63), 813, 126},
+{0},
+{0},
+{0, 189, 0, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_64_values) - offsetof(struct MarioAnimsObj, anim_64)), (u16 *)(offsetof(struct MarioAnimsObj, anim_64_indices) - offsetof(struct MarioAnimsObj, anim_64)), offsetof(struct MarioAnimsObj, anim_64_values) + sizeof(gMarioAnims.anim_64_values) - offsetof(struct MarioAnimsObj, anim_64), 623, 126},
+{0},
+{0},
+{1, 189, 0, 0, 21, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_65_values) - offsetof(struct MarioAnimsObj, anim_65)), (u16 *)(offsetof(struct MarioAnimsObj, anim_65_indices) - offsetof(struct MarioAnimsObj, anim_65)), offsetof(struct MarioAnimsObj, anim_65_values) + sizeof(gMarioAnims.anim_65_values) - offsetof(struct MarioAnimsObj, anim_65), 850, 126},
+{0},
+{0},
+{1, 189, 0, 0, 26, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_66_values) - offsetof(struct MarioAnimsObj, anim_66)), (u16 *)(offsetof(struct MarioAnimsObj, anim_66_indices) - offsetof(struct MarioAnimsObj, anim_66)), offsetof(struct MarioAnimsObj, anim_66_values) + sizeof(gMarioAnims.anim_66_values) - offsetof(struct MarioAnimsObj, anim_66), 974, 126},
+{0},
+{0},
+{1, 189, 0, 0, 5, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_67_values) - offsetof(struct MarioAnimsObj, anim_67)), (u16 *)(offsetof(struct MarioAnimsObj, anim_67_indices) - offsetof(struct MarioAnimsObj, anim_67)), offsetof(struct MarioAnimsObj, anim_67_values) + sizeof(gMarioAnims.anim_67_values) - offsetof(struct MarioAnimsObj, anim_67), 193, 126},
+{0},
+{0},
+{1, 189, 0, 0, 4, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_68_values) - offsetof(struct MarioAnimsObj, anim_68)), (u16 *)(offsetof(struct MarioAnimsObj, anim_68_indices) - offsetof(struct MarioAnimsObj, anim_68)), offsetof(struct MarioAnimsObj, anim_68_values) + sizeof(gMarioAnims.anim_68_values) - offsetof(struct MarioAnimsObj, anim_68), 170, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_69_values) - offsetof(struct MarioAnimsObj, anim_69)), (u16 *)(offsetof(struct MarioAnimsObj, anim_69_indices) - offsetof(struct MarioAnimsObj, anim_69)), offsetof(struct MarioAnimsObj, anim_69_values) + sizeof(gMarioAnims.anim_69_values) - offsetof(struct MarioAnimsObj, anim_69), 382, 126},
+{0},
+{0},
+{1, 189, 0, 0, 13, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6A_values) - offsetof(struct MarioAnimsObj, anim_6A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6A_indices) - offsetof(struct MarioAnimsObj, anim_6A)), offsetof(struct MarioAnimsObj, anim_6A_values) + sizeof(gMarioAnims.anim_6A_values) - offsetof(struct MarioAnimsObj, anim_6A), 530, 126},
+{0},
+{0},
+{1, 189, 0, 0, 11, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6B_values) - offsetof(struct MarioAnimsObj, anim_6B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6B_indices) - offsetof(struct MarioAnimsObj, anim_6B)), offsetof(struct MarioAnimsObj, anim_6B_values) + sizeof(gMarioAnims.anim_6B_values) - offsetof(struct MarioAnimsObj, anim_6B), 470, 126},
+{0},
+{0},
+{0, 189, 0, 0, 27, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6C_values) - offsetof(struct MarioAnimsObj, anim_6C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6C_indices) - offsetof(struct MarioAnimsObj, anim_6C)), offsetof(struct MarioAnimsObj, anim_6C_values) + sizeof(gMarioAnims.anim_6C_values) - offsetof(struct MarioAnimsObj, anim_6C), 642, 126},
+{0},
+{0},
+{1, 189, 0, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6D_values) - offsetof(struct MarioAnimsObj, anim_6D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6D_indices) - offsetof(struct MarioAnimsObj, anim_6D)), offsetof(struct MarioAnimsObj, anim_6D_values) + sizeof(gMarioAnims.anim_6D_values) - offsetof(struct MarioAnimsObj, anim_6D), 643, 126},
+{0},
+{0},
+{1, 189, 0, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6E_values) - offsetof(struct MarioAnimsObj, anim_6E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6E_indices) - offsetof(struct MarioAnimsObj, anim_6E)), offsetof(struct MarioAnimsObj, anim_6E_values) + sizeof(gMarioAnims.anim_6E_values) - offsetof(struct MarioAnimsObj, anim_6E), 568, 126},
+{0},
+{0},
+{0, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6F_70_values) - offsetof(struct MarioAnimsObj, anim_6F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6F_70_indices) - offsetof(struct MarioAnimsObj, anim_6F)), offsetof(struct MarioAnimsObj, anim_6F_70_values) + sizeof(gMarioAnims.anim_6F_70_values) - offsetof(struct MarioAnimsObj, anim_6F), 49, 126},
+{2, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_6F_70_values) - offsetof(struct MarioAnimsObj, anim_70)), (u16 *)(offsetof(struct MarioAnimsObj, anim_6F_70_indices) - offsetof(struct MarioAnimsObj, anim_70)), offsetof(struct MarioAnimsObj, anim_6F_70_values) + sizeof(gMarioAnims.anim_6F_70_values) - offsetof(struct MarioAnimsObj, anim_70), 49, 126},
+{0},
+{0},
+{1, 189, 0, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_71_values) - offsetof(struct MarioAnimsObj, anim_71)), (u16 *)(offsetof(struct MarioAnimsObj, anim_71_indices) - offsetof(struct MarioAnimsObj, anim_71)), offsetof(struct MarioAnimsObj, anim_71_values) + sizeof(gMarioAnims.anim_71_values) - offsetof(struct MarioAnimsObj, anim_71), 1039, 126},
+{0},
+{0},
+{0, 189, 0, 0, 72, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_72_73_values) - offsetof(struct MarioAnimsObj, anim_72)), (u16 *)(offsetof(struct MarioAnimsObj, anim_72_73_indices) - offsetof(struct MarioAnimsObj, anim_72)), offsetof(struct MarioAnimsObj, anim_72_73_values) + sizeof(gMarioAnims.anim_72_73_values) - offsetof(struct MarioAnimsObj, anim_72), 2171, 126},
+{0, 189, 0, 0, 72, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_72_73_values) - offsetof(struct MarioAnimsObj, anim_73)), (u16 *)(offsetof(struct MarioAnimsObj, anim_72_73_indices) - offsetof(struct MarioAnimsObj, anim_73)), offsetof(struct MarioAnimsObj, anim_72_73_values) + sizeof(gMarioAnims.anim_72_73_values) - offsetof(struct MarioAnimsObj, anim_73), 2171, 126},
+{0},
+{0},
+{1, 189, 0, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_74_values) - offsetof(struct MarioAnimsObj, anim_74)), (u16 *)(offsetof(struct MarioAnimsObj, anim_74_indices) - offsetof(struct MarioAnimsObj, anim_74)), offsetof(struct MarioAnimsObj, anim_74_values) + sizeof(gMarioAnims.anim_74_values) - offsetof(struct MarioAnimsObj, anim_74), 922, 126},
+{0},
+{0},
+{1, 189, 0, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_75_values) - offsetof(struct MarioAnimsObj, anim_75)), (u16 *)(offsetof(struct MarioAnimsObj, anim_75_indices) - offsetof(struct MarioAnimsObj, anim_75)), offsetof(struct MarioAnimsObj, anim_75_values) + sizeof(gMarioAnims.anim_75_values) - offsetof(struct MarioAnimsObj, anim_75), 946, 126},
+{0},
+{0},
+{1, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_76_values) - offsetof(struct MarioAnimsObj, anim_76)), (u16 *)(offsetof(struct MarioAnimsObj, anim_76_indices) - offsetof(struct MarioAnimsObj, anim_76)), offsetof(struct MarioAnimsObj, anim_76_values) + sizeof(gMarioAnims.anim_76_values) - offsetof(struct MarioAnimsObj, anim_76), 2324, 126},
+{0},
+{0},
+{0, 189, 0, 0, 100, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_77_values) - offsetof(struct MarioAnimsObj, anim_77)), (u16 *)(offsetof(struct MarioAnimsObj, anim_77_indices) - offsetof(struct MarioAnimsObj, anim_77)), offsetof(struct MarioAnimsObj, anim_77_values) + sizeof(gMarioAnims.anim_77_values) - offsetof(struct MarioAnimsObj, anim_77), 1232, 126},
+{0},
+{0},
+{0, 189, 0, 0, 149, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_78_values) - offsetof(struct MarioAnimsObj, anim_78)), (u16 *)(offsetof(struct MarioAnimsObj, anim_78_indices) - offsetof(struct MarioAnimsObj, anim_78)), offsetof(struct MarioAnimsObj, anim_78_values) + sizeof(gMarioAnims.anim_78_values) - offsetof(struct MarioAnimsObj, anim_78), 5227, 126},
+{0},
+{0},
+{1, 189, 0, 0, 53, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_79_values) - offsetof(struct MarioAnimsObj, anim_79)), (u16 *)(offsetof(struct MarioAnimsObj, anim_79_indices) - offsetof(struct MarioAnimsObj, anim_79)), offsetof(struct MarioAnimsObj, anim_79_values) + sizeof(gMarioAnims.anim_79_values) - offsetof(struct MarioAnimsObj, anim_79), 1817, 126},
+{0},
+{0},
+{0, 189, 0, 0, 6, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_7A_values) - offsetof(struct MarioAnimsObj, anim_7A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_7A_indices) - offsetof(struct MarioAnimsObj, anim_7A)), offsetof(struct MarioAnimsObj, anim_7A_values) + sizeof(gMarioAnims.anim_7A_values) - offsetof(struct MarioAnimsObj, anim_7A), 201, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_7B_values) - offsetof(struct MarioAnimsObj, anim_7B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_7B_indices) - offsetof(struct MarioAnimsObj, anim_7B)), offsetof(struct MarioAnimsObj, anim_7B_values) + sizeof(gMarioAnims.anim_7B_values) - offsetof(struct MarioAnimsObj, anim_7B), 1180, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_7C_values) - offsetof(struct MarioAnimsObj, anim_7C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_7C_indices) - offsetof(struct MarioAnimsObj, anim_7C)), offsetof(struct MarioAnimsObj, anim_7C_values) + sizeof(gMarioAnims.anim_7C_values) - offsetof(struct MarioAnimsObj, anim_7C), 1150, 126},
+{0},
+{0},
+{0, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_7D_values) - offsetof(struct MarioAnimsObj, anim_7D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_7D_indices) - offsetof(struct MarioAnimsObj, anim_7D)), offsetof(struct MarioAnimsObj, anim_7D_values) + sizeof(gMarioAnims.anim_7D_values) - offsetof(struct MarioAnimsObj, anim_7D), 557, 126},
+{0},
+{0},
+{0, 189, 0, 0, 90, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_7E_values) - offsetof(struct MarioAnimsObj, anim_7E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_7E_indices) - offsetof(struct MarioAnimsObj, anim_7E)), offsetof(struct MarioAnimsObj, anim_7E_values) + sizeof(gMarioAnims.anim_7E_values) - offsetof(struct MarioAnimsObj, anim_7E), 2269, 126},
+{0},
+{0},
+{0, 189, 0, 0, 64, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_7F_values) - offsetof(struct MarioAnimsObj, anim_7F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_7F_indices) - offsetof(struct MarioAnimsObj, anim_7F)), offsetof(struct MarioAnimsObj, anim_7F_values) + sizeof(gMarioAnims.anim_7F_values) - offsetof(struct MarioAnimsObj, anim_7F), 1811, 126},
+{0},
+{0},
+{0, 189, 0, 0, 64, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_80_values) - offsetof(struct MarioAnimsObj, anim_80)), (u16 *)(offsetof(struct MarioAnimsObj, anim_80_indices) - offsetof(struct MarioAnimsObj, anim_80)), offsetof(struct MarioAnimsObj, anim_80_values) + sizeof(gMarioAnims.anim_80_values) - offsetof(struct MarioAnimsObj, anim_80), 2124, 126},
+{0},
+{0},
+{1, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_81_values) - offsetof(struct MarioAnimsObj, anim_81)), (u16 *)(offsetof(struct MarioAnimsObj, anim_81_indices) - offsetof(struct MarioAnimsObj, anim_81)), offsetof(struct MarioAnimsObj, anim_81_values) + sizeof(gMarioAnims.anim_81_values) - offsetof(struct MarioAnimsObj, anim_81), 2154, 126},
+{0},
+{0},
+{1, 189, 0, 0, 67, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_82_values) - offsetof(struct MarioAnimsObj, anim_82)), (u16 *)(offsetof(struct MarioAnimsObj, anim_82_indices) - offsetof(struct MarioAnimsObj, anim_82)), offsetof(struct MarioAnimsObj, anim_82_values) + sizeof(gMarioAnims.anim_82_values) - offsetof(struct MarioAnimsObj, anim_82), 2885, 126},
+{0},
+{0},
+{1, 189, 0, 0, 59, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_83_values) - offsetof(struct MarioAnimsObj, anim_83)), (u16 *)(offsetof(struct MarioAnimsObj, anim_83_indices) - offsetof(struct MarioAnimsObj, anim_83)), offsetof(struct MarioAnimsObj, anim_83_values) + sizeof(gMarioAnims.anim_83_values) - offsetof(struct MarioAnimsObj, anim_83), 2367, 126},
+{0},
+{0},
+{1, 189, 0, 0, 64, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_84_values) - offsetof(struct MarioAnimsObj, anim_84)), (u16 *)(offsetof(struct MarioAnimsObj, anim_84_indices) - offsetof(struct MarioAnimsObj, anim_84)), offsetof(struct MarioAnimsObj, anim_84_values) + sizeof(gMarioAnims.anim_84_values) - offsetof(struct MarioAnimsObj, anim_84), 2378, 126},
+{0},
+{0},
+{0, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_85_values) - offsetof(struct MarioAnimsObj, anim_85)), (u16 *)(offsetof(struct MarioAnimsObj, anim_85_indices) - offsetof(struct MarioAnimsObj, anim_85)), offsetof(struct MarioAnimsObj, anim_85_values) + sizeof(gMarioAnims.anim_85_values) - offsetof(struct MarioAnimsObj, anim_85), 162, 126},
+{0},
+{0},
+{1, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_86_values) - offsetof(struct MarioAnimsObj, anim_86)), (u16 *)(offsetof(struct MarioAnimsObj, anim_86_indices) - offsetof(struct MarioAnimsObj, anim_86)), offsetof(struct MarioAnimsObj, anim_86_values) + sizeof(gMarioAnims.anim_86_values) - offsetof(struct MarioAnimsObj, anim_86), 1451, 126},
+{0},
+{0},
+{0, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_87_values) - offsetof(struct MarioAnimsObj, anim_87)), (u16 *)(offsetof(struct MarioAnimsObj, anim_87_indices) - offsetof(struct MarioAnimsObj, anim_87)), offsetof(struct MarioAnimsObj, anim_87_values) + sizeof(gMarioAnims.anim_87_values) - offsetof(struct MarioAnimsObj, anim_87), 782, 126},
+{0},
+{0},
+{1, 189, 0, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_88_89_values) - offsetof(struct MarioAnimsObj, anim_88)), (u16 *)(offsetof(struct MarioAnimsObj, anim_88_89_indices) - offsetof(struct MarioAnimsObj, anim_88)), offsetof(struct MarioAnimsObj, anim_88_89_values) + sizeof(gMarioAnims.anim_88_89_values) - offsetof(struct MarioAnimsObj, anim_88), 630, 126},
+{1, 189, 20, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_88_89_values) - offsetof(struct MarioAnimsObj, anim_89)), (u16 *)(offsetof(struct MarioAnimsObj, anim_88_89_indices) - offsetof(struct MarioAnimsObj, anim_89)), offsetof(struct MarioAnimsObj, anim_88_89_values) + sizeof(gMarioAnims.anim_88_89_values) - offsetof(struct MarioAnimsObj, anim_89), 630, 126},
+{0},
+{0},
+{1, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_8A_values) - offsetof(struct MarioAnimsObj, anim_8A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_8A_indices) - offsetof(struct MarioAnimsObj, anim_8A)), offsetof(struct MarioAnimsObj, anim_8A_values) + sizeof(gMarioAnims.anim_8A_values) - offsetof(struct MarioAnimsObj, anim_8A), 1490, 126},
+{0},
+{0},
+{1, 189, 0, 0, 37, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_8B_values) - offsetof(struct MarioAnimsObj, anim_8B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_8B_indices) - offsetof(struct MarioAnimsObj, anim_8B)), offsetof(struct MarioAnimsObj, anim_8B_values) + sizeof(gMarioAnims.anim_8B_values) - offsetof(struct MarioAnimsObj, anim_8B), 1485, 126},
+{0},
+{0},
+{1, 189, 0, 0, 8, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_8C_values) - offsetof(struct MarioAnimsObj, anim_8C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_8C_indices) - offsetof(struct MarioAnimsObj, anim_8C)), offsetof(struct MarioAnimsObj, anim_8C_values) + sizeof(gMarioAnims.anim_8C_values) - offsetof(struct MarioAnimsObj, anim_8C), 323, 126},
+{0},
+{0},
+{1, 189, 0, 0, 14, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_8D_values) - offsetof(struct MarioAnimsObj, anim_8D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_8D_indices) - offsetof(struct MarioAnimsObj, anim_8D)), offsetof(struct MarioAnimsObj, anim_8D_values) + sizeof(gMarioAnims.anim_8D_values) - offsetof(struct MarioAnimsObj, anim_8D), 543, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_8E_8F_values) - offsetof(struct MarioAnimsObj, anim_8E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_8E_8F_indices) - offsetof(struct MarioAnimsObj, anim_8E)), offsetof(struct MarioAnimsObj, anim_8E_8F_values) + sizeof(gMarioAnims.anim_8E_8F_values) - offsetof(struct MarioAnimsObj, anim_8E), 809, 126},
+{1, 189, 1, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_8E_8F_values) - offsetof(struct MarioAnimsObj, anim_8F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_8E_8F_indices) - offsetof(struct MarioAnimsObj, anim_8F)), offsetof(struct MarioAnimsObj, anim_8E_8F_values) + sizeof(gMarioAnims.anim_8E_8F_values) - offsetof(struct MarioAnimsObj, anim_8F), 809, 126},
+{0},
+{0},
+{1, 189, 0, 0, 15, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_90_values) - offsetof(struct MarioAnimsObj, anim_90)), (u16 *)(offsetof(struct MarioAnimsObj, anim_90_indices) - offsetof(struct MarioAnimsObj, anim_90)), offsetof(struct MarioAnimsObj, anim_90_values) + sizeof(gMarioAnims.anim_90_values) - offsetof(struct MarioAnimsObj, anim_90), 506, 126},
+{0},
+{0},
+{0, 189, 0, 0, 8, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_91_values) - offsetof(struct MarioAnimsObj, anim_91)), (u16 *)(offsetof(struct MarioAnimsObj, anim_91_indices) - offsetof(struct MarioAnimsObj, anim_91)), offsetof(struct MarioAnimsObj, anim_91_values) + sizeof(gMarioAnims.anim_91_values) - offsetof(struct MarioAnimsObj, anim_91), 133, 126},
+{0},
+{0},
+{0, 189, 27, 0, 116, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_92_values) - offsetof(struct MarioAnimsObj, anim_92)), (u16 *)(offsetof(struct MarioAnimsObj, anim_92_indices) - offsetof(struct MarioAnimsObj, anim_92)), offsetof(struct MarioAnimsObj, anim_92_values) + sizeof(gMarioAnims.anim_92_values) - offsetof(struct MarioAnimsObj, anim_92), 2800, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_93_values) - offsetof(struct MarioAnimsObj, anim_93)), (u16 *)(offsetof(struct MarioAnimsObj, anim_93_indices) - offsetof(struct MarioAnimsObj, anim_93)), offsetof(struct MarioAnimsObj, anim_93_values) + sizeof(gMarioAnims.anim_93_values) - offsetof(struct MarioAnimsObj, anim_93), 301, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_94_values) - offsetof(struct MarioAnimsObj, anim_94)), (u16 *)(offsetof(struct MarioAnimsObj, anim_94_indices) - offsetof(struct MarioAnimsObj, anim_94)), offsetof(struct MarioAnimsObj, anim_94_values) + sizeof(gMarioAnims.anim_94_values) - offsetof(struct MarioAnimsObj, anim_94), 40, 126},
+{0},
+{0},
+{1, 189, 0, 0, 5, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_95_values) - offsetof(struct MarioAnimsObj, anim_95)), (u16 *)(offsetof(struct MarioAnimsObj, anim_95_indices) - offsetof(struct MarioAnimsObj, anim_95)), offsetof(struct MarioAnimsObj, anim_95_values) + sizeof(gMarioAnims.anim_95_values) - offsetof(struct MarioAnimsObj, anim_95), 140, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_96_values) - offsetof(struct MarioAnimsObj, anim_96)), (u16 *)(offsetof(struct MarioAnimsObj, anim_96_indices) - offsetof(struct MarioAnimsObj, anim_96)), offsetof(struct MarioAnimsObj, anim_96_values) + sizeof(gMarioAnims.anim_96_values) - offsetof(struct MarioAnimsObj, anim_96), 340, 126},
+{0},
+{0},
+{1, 189, 0, 0, 6, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_97_values) - offsetof(struct MarioAnimsObj, anim_97)), (u16 *)(offsetof(struct MarioAnimsObj, anim_97_indices) - offsetof(struct MarioAnimsObj, anim_97)), offsetof(struct MarioAnimsObj, anim_97_values) + sizeof(gMarioAnims.anim_97_values) - offsetof(struct MarioAnimsObj, anim_97), 208, 126},
+{0},
+{0},
+{0, 189, 0, 0, 90, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_98_values) - offsetof(struct MarioAnimsObj, anim_98)), (u16 *)(offsetof(struct MarioAnimsObj, anim_98_indices) - offsetof(struct MarioAnimsObj, anim_98)), offsetof(struct MarioAnimsObj, anim_98_values) + sizeof(gMarioAnims.anim_98_values) - offsetof(struct MarioAnimsObj, anim_98), 1379, 126},
+{0},
+{0},
+{0, 189, 0, 0, 92, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_99_values) - offsetof(struct MarioAnimsObj, anim_99)), (u16 *)(offsetof(struct MarioAnimsObj, anim_99_indices) - offsetof(struct MarioAnimsObj, anim_99)), offsetof(struct MarioAnimsObj, anim_99_values) + sizeof(gMarioAnims.anim_99_values) - offsetof(struct MarioAnimsObj, anim_99), 3507, 126},
+{0},
+{0},
+{1, 189, 0, 0, 8, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_9A_values) - offsetof(struct MarioAnimsObj, anim_9A)), (u16 *)(offsetof(struct MarioAnimsObj, anim_9A_indices) - offsetof(struct MarioAnimsObj, anim_9A)), offsetof(struct MarioAnimsObj, anim_9A_values) + sizeof(gMarioAnims.anim_9A_values) - offsetof(struct MarioAnimsObj, anim_9A), 322, 126},
+{0},
+{0},
+{1, 189, 0, 0, 8, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_9B_values) - offsetof(struct MarioAnimsObj, anim_9B)), (u16 *)(offsetof(struct MarioAnimsObj, anim_9B_indices) - offsetof(struct MarioAnimsObj, anim_9B)), offsetof(struct MarioAnimsObj, anim_9B_values) + sizeof(gMarioAnims.anim_9B_values) - offsetof(struct MarioAnimsObj, anim_9B), 315, 126},
+{0},
+{0},
+{9, 189, 0, 0, 64, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_9C_values) - offsetof(struct MarioAnimsObj, anim_9C)), (u16 *)(offsetof(struct MarioAnimsObj, anim_9C_indices) - offsetof(struct MarioAnimsObj, anim_9C)), offsetof(struct MarioAnimsObj, anim_9C_values) + sizeof(gMarioAnims.anim_9C_values) - offsetof(struct MarioAnimsObj, anim_9C), 2442, 126},
+{0},
+{0},
+{9, 189, 0, 0, 26, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_9D_values) - offsetof(struct MarioAnimsObj, anim_9D)), (u16 *)(offsetof(struct MarioAnimsObj, anim_9D_indices) - offsetof(struct MarioAnimsObj, anim_9D)), offsetof(struct MarioAnimsObj, anim_9D_values) + sizeof(gMarioAnims.anim_9D_values) - offsetof(struct MarioAnimsObj, anim_9D), 972, 126},
+{0},
+{0},
+{1, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_9E_values) - offsetof(struct MarioAnimsObj, anim_9E)), (u16 *)(offsetof(struct MarioAnimsObj, anim_9E_indices) - offsetof(struct MarioAnimsObj, anim_9E)), offsetof(struct MarioAnimsObj, anim_9E_values) + sizeof(gMarioAnims.anim_9E_values) - offsetof(struct MarioAnimsObj, anim_9E), 2004, 126},
+{0},
+{0},
+{1, 189, 0, 0, 16, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_9F_values) - offsetof(struct MarioAnimsObj, anim_9F)), (u16 *)(offsetof(struct MarioAnimsObj, anim_9F_indices) - offsetof(struct MarioAnimsObj, anim_9F)), offsetof(struct MarioAnimsObj, anim_9F_values) + sizeof(gMarioAnims.anim_9F_values) - offsetof(struct MarioAnimsObj, anim_9F), 387, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A0_values) - offsetof(struct MarioAnimsObj, anim_A0)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A0_indices) - offsetof(struct MarioAnimsObj, anim_A0)), offsetof(struct MarioAnimsObj, anim_A0_values) + sizeof(gMarioAnims.anim_A0_values) - offsetof(struct MarioAnimsObj, anim_A0), 195, 126},
+{0},
+{0},
+{0, 189, 0, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A1_values) - offsetof(struct MarioAnimsObj, anim_A1)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A1_indices) - offsetof(struct MarioAnimsObj, anim_A1)), offsetof(struct MarioAnimsObj, anim_A1_values) + sizeof(gMarioAnims.anim_A1_values) - offsetof(struct MarioAnimsObj, anim_A1), 460, 126},
+{0},
+{0},
+{1, 189, 0, 0, 23, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A2_values) - offsetof(struct MarioAnimsObj, anim_A2)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A2_indices) - offsetof(struct MarioAnimsObj, anim_A2)), offsetof(struct MarioAnimsObj, anim_A2_values) + sizeof(gMarioAnims.anim_A2_values) - offsetof(struct MarioAnimsObj, anim_A2), 724, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A3_values) - offsetof(struct MarioAnimsObj, anim_A3)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A3_indices) - offsetof(struct MarioAnimsObj, anim_A3)), offsetof(struct MarioAnimsObj, anim_A3_values) + sizeof(gMarioAnims.anim_A3_values) - offsetof(struct MarioAnimsObj, anim_A3), 1295, 126},
+{0},
+{0},
+{0, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A4_values) - offsetof(struct MarioAnimsObj, anim_A4)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A4_indices) - offsetof(struct MarioAnimsObj, anim_A4)), offsetof(struct MarioAnimsObj, anim_A4_values) + sizeof(gMarioAnims.anim_A4_values) - offsetof(struct MarioAnimsObj, anim_A4), 825, 126},
+{0},
+{0},
+{1, 189, 0, 0, 80, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A5_values) - offsetof(struct MarioAnimsObj, anim_A5)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A5_indices) - offsetof(struct MarioAnimsObj, anim_A5)), offsetof(struct MarioAnimsObj, anim_A5_values) + sizeof(gMarioAnims.anim_A5_values) - offsetof(struct MarioAnimsObj, anim_A5), 2574, 126},
+{0},
+{0},
+{1, 189, 0, 0, 70, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A6_values) - offsetof(struct MarioAnimsObj, anim_A6)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A6_indices) - offsetof(struct MarioAnimsObj, anim_A6)), offsetof(struct MarioAnimsObj, anim_A6_values) + sizeof(gMarioAnims.anim_A6_values) - offsetof(struct MarioAnimsObj, anim_A6), 2323, 126},
+{0},
+{0},
+{1, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A7_values) - offsetof(struct MarioAnimsObj, anim_A7)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A7_indices) - offsetof(struct MarioAnimsObj, anim_A7)), offsetof(struct MarioAnimsObj, anim_A7_values) + sizeof(gMarioAnims.anim_A7_values) - offsetof(struct MarioAnimsObj, anim_A7), 1530, 126},
+{0},
+{0},
+{1, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A8_values) - offsetof(struct MarioAnimsObj, anim_A8)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A8_indices) - offsetof(struct MarioAnimsObj, anim_A8)), offsetof(struct MarioAnimsObj, anim_A8_values) + sizeof(gMarioAnims.anim_A8_values) - offsetof(struct MarioAnimsObj, anim_A8), 1955, 126},
+{0},
+{0},
+{1, 189, 0, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_A9_values) - offsetof(struct MarioAnimsObj, anim_A9)), (u16 *)(offsetof(struct MarioAnimsObj, anim_A9_indices) - offsetof(struct MarioAnimsObj, anim_A9)), offsetof(struct MarioAnimsObj, anim_A9_values) + sizeof(gMarioAnims.anim_A9_values) - offsetof(struct MarioAnimsObj, anim_A9), 864, 126},
+{0},
+{0},
+{1, 189, 0, 0, 13, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_AA_values) - offsetof(struct MarioAnimsObj, anim_AA)), (u16 *)(offsetof(struct MarioAnimsObj, anim_AA_indices) - offsetof(struct MarioAnimsObj, anim_AA)), offsetof(struct MarioAnimsObj, anim_AA_values) + sizeof(gMarioAnims.anim_AA_values) - offsetof(struct MarioAnimsObj, anim_AA), 486, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_AB_values) - offsetof(struct MarioAnimsObj, anim_AB)), (u16 *)(offsetof(struct MarioAnimsObj, anim_AB_indices) - offsetof(struct MarioAnimsObj, anim_AB)), offsetof(struct MarioAnimsObj, anim_AB_values) + sizeof(gMarioAnims.anim_AB_values) - offsetof(struct MarioAnimsObj, anim_AB), 375, 126},
+{0},
+{0},
+{0, 189, 8, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_AC_values) - offsetof(struct MarioAnimsObj, anim_AC)), (u16 *)(offsetof(struct MarioAnimsObj, anim_AC_indices) - offsetof(struct MarioAnimsObj, anim_AC)), offsetof(struct MarioAnimsObj, anim_AC_values) + sizeof(gMarioAnims.anim_AC_values) - offsetof(struct MarioAnimsObj, anim_AC), 853, 126},
+{0},
+{0},
+{1, 189, 0, 0, 25, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_AD_values) - offsetof(struct MarioAnimsObj, anim_AD)), (u16 *)(offsetof(struct MarioAnimsObj, anim_AD_indices) - offsetof(struct MarioAnimsObj, anim_AD)), offsetof(struct MarioAnimsObj, anim_AD_values) + sizeof(gMarioAnims.anim_AD_values) - offsetof(struct MarioAnimsObj, anim_AD), 930, 126},
+{0},
+{0},
+{1, 189, 0, 0, 11, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_AE_values) - offsetof(struct MarioAnimsObj, anim_AE)), (u16 *)(offsetof(struct MarioAnimsObj, anim_AE_indices) - offsetof(struct MarioAnimsObj, anim_AE)), offsetof(struct MarioAnimsObj, anim_AE_values) + sizeof(gMarioAnims.anim_AE_values) - offsetof(struct MarioAnimsObj, anim_AE), 478, 126},
+{0},
+{0},
+{1, 189, 0, 0, 25, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_AF_values) - offsetof(struct MarioAnimsObj, anim_AF)), (u16 *)(offsetof(struct MarioAnimsObj, anim_AF_indices) - offsetof(struct MarioAnimsObj, anim_AF)), offsetof(struct MarioAnimsObj, anim_AF_values) + sizeof(gMarioAnims.anim_AF_values) - offsetof(struct MarioAnimsObj, anim_AF), 1080, 126},
+{0},
+{0},
+{1, 189, 0, 0, 5, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B0_values) - offsetof(struct MarioAnimsObj, anim_B0)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B0_indices) - offsetof(struct MarioAnimsObj, anim_B0)), offsetof(struct MarioAnimsObj, anim_B0_values) + sizeof(gMarioAnims.anim_B0_values) - offsetof(struct MarioAnimsObj, anim_B0), 220, 126},
+{0},
+{0},
+{1, 189, 0, 0, 28, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B1_values) - offsetof(struct MarioAnimsObj, anim_B1)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B1_indices) - offsetof(struct MarioAnimsObj, anim_B1)), offsetof(struct MarioAnimsObj, anim_B1_values) + sizeof(gMarioAnims.anim_B1_values) - offsetof(struct MarioAnimsObj, anim_B1), 1209, 126},
+{0},
+{0},
+{0, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B2_values) - offsetof(struct MarioAnimsObj, anim_B2)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B2_indices) - offsetof(struct MarioAnimsObj, anim_B2)), offsetof(struct MarioAnimsObj, anim_B2_values) + sizeof(gMarioAnims.anim_B2_values) - offsetof(struct MarioAnimsObj, anim_B2), 912, 126},
+{0},
+{0},
+{1, 189, 0, 0, 83, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B3_values) - offsetof(struct MarioAnimsObj, anim_B3)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B3_indices) - offsetof(struct MarioAnimsObj, anim_B3)), offsetof(struct MarioAnimsObj, anim_B3_values) + sizeof(gMarioAnims.anim_B3_values) - offsetof(struct MarioAnimsObj, anim_B3), 3247, 126},
+{0},
+{0},
+{1, 189, 0, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B4_values) - offsetof(struct MarioAnimsObj, anim_B4)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B4_indices) - offsetof(struct MarioAnimsObj, anim_B4)), offsetof(struct MarioAnimsObj, anim_B4_values) + sizeof(gMarioAnims.anim_B4_values) - offsetof(struct MarioAnimsObj, anim_B4), 923, 126},
+{0},
+{0},
+{1, 189, 0, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B5_B6_values) - offsetof(struct MarioAnimsObj, anim_B5)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B5_B6_indices) - offsetof(struct MarioAnimsObj, anim_B5)), offsetof(struct MarioAnimsObj, anim_B5_B6_values) + sizeof(gMarioAnims.anim_B5_B6_values) - offsetof(struct MarioAnimsObj, anim_B5), 691, 126},
+{1, 189, 19, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B5_B6_values) - offsetof(struct MarioAnimsObj, anim_B6)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B5_B6_indices) - offsetof(struct MarioAnimsObj, anim_B6)), offsetof(struct MarioAnimsObj, anim_B5_B6_values) + sizeof(gMarioAnims.anim_B5_B6_values) - offsetof(struct MarioAnimsObj, anim_B6), 691, 126},
+{0},
+{0},
+{1, 189, 0, 0, 40, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B7_values) - offsetof(struct MarioAnimsObj, anim_B7)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B7_indices) - offsetof(struct MarioAnimsObj, anim_B7)), offsetof(struct MarioAnimsObj, anim_B7_values) + sizeof(gMarioAnims.anim_B7_values) - offsetof(struct MarioAnimsObj, anim_B7), 1490, 126},
+{0},
+{0},
+{0, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B8_values) - offsetof(struct MarioAnimsObj, anim_B8)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B8_indices) - offsetof(struct MarioAnimsObj, anim_B8)), offsetof(struct MarioAnimsObj, anim_B8_values) + sizeof(gMarioAnims.anim_B8_values) - offsetof(struct MarioAnimsObj, anim_B8), 388, 126},
+{0},
+{0},
+{1, 189, 0, 0, 25, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_B9_values) - offsetof(struct MarioAnimsObj, anim_B9)), (u16 *)(offsetof(struct MarioAnimsObj, anim_B9_indices) - offsetof(struct MarioAnimsObj, anim_B9)), offsetof(struct MarioAnimsObj, anim_B9_values) + sizeof(gMarioAnims.anim_B9_values) - offsetof(struct MarioAnimsObj, anim_B9), 1034, 126},
+{0},
+{0},
+{0, 189, 0, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_BA_values) - offsetof(struct MarioAnimsObj, anim_BA)), (u16 *)(offsetof(struct MarioAnimsObj, anim_BA_indices) - offsetof(struct MarioAnimsObj, anim_BA)), offsetof(struct MarioAnimsObj, anim_BA_values) + sizeof(gMarioAnims.anim_BA_values) - offsetof(struct MarioAnimsObj, anim_BA), 493, 126},
+{0},
+{0},
+{0, 189, 0, 0, 97, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_BB_values) - offsetof(struct MarioAnimsObj, anim_BB)), (u16 *)(offsetof(struct MarioAnimsObj, anim_BB_indices) - offsetof(struct MarioAnimsObj, anim_BB)), offsetof(struct MarioAnimsObj, anim_BB_values) + sizeof(gMarioAnims.anim_BB_values) - offsetof(struct MarioAnimsObj, anim_BB), 2066, 126},
+{0},
+{0},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_BC_BD_values) - offsetof(struct MarioAnimsObj, anim_BC)), (u16 *)(offsetof(struct MarioAnimsObj, anim_BC_BD_indices) - offsetof(struct MarioAnimsObj, anim_BC)), offsetof(struct MarioAnimsObj, anim_BC_BD_values) + sizeof(gMarioAnims.anim_BC_BD_values) - offsetof(struct MarioAnimsObj, anim_BC), 764, 126},
+{1, 189, 1, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_BC_BD_values) - offsetof(struct MarioAnimsObj, anim_BD)), (u16 *)(offsetof(struct MarioAnimsObj, anim_BC_BD_indices) - offsetof(struct MarioAnimsObj, anim_BD)), offsetof(struct MarioAnimsObj, anim_BC_BD_values) + sizeof(gMarioAnims.anim_BC_BD_values) - offsetof(struct MarioAnimsObj, anim_BD), 764, 126},
+{0},
+{0},
+{1, 189, 0, 0, 10, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_BE_values) - offsetof(struct MarioAnimsObj, anim_BE)), (u16 *)(offsetof(struct MarioAnimsObj, anim_BE_indices) - offsetof(struct MarioAnimsObj, anim_BE)), offsetof(struct MarioAnimsObj, anim_BE_values) + sizeof(gMarioAnims.anim_BE_values) - offsetof(struct MarioAnimsObj, anim_BE), 380, 126},
+{0},
+{0},
+{1, 189, 0, 0, 24, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_BF_values) - offsetof(struct MarioAnimsObj, anim_BF)), (u16 *)(offsetof(struct MarioAnimsObj, anim_BF_indices) - offsetof(struct MarioAnimsObj, anim_BF)), offsetof(struct MarioAnimsObj, anim_BF_values) + sizeof(gMarioAnims.anim_BF_values) - offsetof(struct MarioAnimsObj, anim_BF), 968, 126},
+{0},
+{0},
+{1, 189, 0, 0, 32, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C0_values) - offsetof(struct MarioAnimsObj, anim_C0)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C0_indices) - offsetof(struct MarioAnimsObj, anim_C0)), offsetof(struct MarioAnimsObj, anim_C0_values) + sizeof(gMarioAnims.anim_C0_values) - offsetof(struct MarioAnimsObj, anim_C0), 1226, 126},
+{0},
+{0},
+{1, 189, 0, 0, 36, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C1_values) - offsetof(struct MarioAnimsObj, anim_C1)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C1_indices) - offsetof(struct MarioAnimsObj, anim_C1)), offsetof(struct MarioAnimsObj, anim_C1_values) + sizeof(gMarioAnims.anim_C1_values) - offsetof(struct MarioAnimsObj, anim_C1), 1234, 126},
+{0},
+{0},
+{0, 189, 0, 0, 90, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C2_values) - offsetof(struct MarioAnimsObj, anim_C2)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C2_indices) - offsetof(struct MarioAnimsObj, anim_C2)), offsetof(struct MarioAnimsObj, anim_C2_values) + sizeof(gMarioAnims.anim_C2_values) - offsetof(struct MarioAnimsObj, anim_C2), 2711, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C3_values) - offsetof(struct MarioAnimsObj, anim_C3)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C3_indices) - offsetof(struct MarioAnimsObj, anim_C3)), offsetof(struct MarioAnimsObj, anim_C3_values) + sizeof(gMarioAnims.anim_C3_values) - offsetof(struct MarioAnimsObj, anim_C3), 971, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C4_values) - offsetof(struct MarioAnimsObj, anim_C4)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C4_indices) - offsetof(struct MarioAnimsObj, anim_C4)), offsetof(struct MarioAnimsObj, anim_C4_values) + sizeof(gMarioAnims.anim_C4_values) - offsetof(struct MarioAnimsObj, anim_C4), 971, 126},
+{0},
+{0},
+{1, 189, 0, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C5_values) - offsetof(struct MarioAnimsObj, anim_C5)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C5_indices) - offsetof(struct MarioAnimsObj, anim_C5)), offsetof(struct MarioAnimsObj, anim_C5_values) + sizeof(gMarioAnims.anim_C5_values) - offsetof(struct MarioAnimsObj, anim_C5), 971, 126},
+{0},
+{0},
+{0, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C6_values) - offsetof(struct MarioAnimsObj, anim_C6)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C6_indices) - offsetof(struct MarioAnimsObj, anim_C6)), offsetof(struct MarioAnimsObj, anim_C6_values) + sizeof(gMarioAnims.anim_C6_values) - offsetof(struct MarioAnimsObj, anim_C6), 833, 126},
+{0},
+{0},
+{0, 189, 0, 0, 50, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C7_values) - offsetof(struct MarioAnimsObj, anim_C7)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C7_indices) - offsetof(struct MarioAnimsObj, anim_C7)), offsetof(struct MarioAnimsObj, anim_C7_values) + sizeof(gMarioAnims.anim_C7_values) - offsetof(struct MarioAnimsObj, anim_C7), 1422, 126},
+{0},
+{0},
+{1, 189, 6, 0, 20, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C8_values) - offsetof(struct MarioAnimsObj, anim_C8)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C8_indices) - offsetof(struct MarioAnimsObj, anim_C8)), offsetof(struct MarioAnimsObj, anim_C8_values) + sizeof(gMarioAnims.anim_C8_values) - offsetof(struct MarioAnimsObj, anim_C8), 824, 126},
+{0},
+{0},
+{1, 189, 0, 0, 21, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_C9_values) - offsetof(struct MarioAnimsObj, anim_C9)), (u16 *)(offsetof(struct MarioAnimsObj, anim_C9_indices) - offsetof(struct MarioAnimsObj, anim_C9)), offsetof(struct MarioAnimsObj, anim_C9_values) + sizeof(gMarioAnims.anim_C9_values) - offsetof(struct MarioAnimsObj, anim_C9), 970, 126},
+{0},
+{0},
+{0, 189, 25, 0, 30, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_CA_values) - offsetof(struct MarioAnimsObj, anim_CA)), (u16 *)(offsetof(struct MarioAnimsObj, anim_CA_indices) - offsetof(struct MarioAnimsObj, anim_CA)), offsetof(struct MarioAnimsObj, anim_CA_values) + sizeof(gMarioAnims.anim_CA_values) - offsetof(struct MarioAnimsObj, anim_CA), 999, 126},
+{0},
+{0},
+{1, 189, 0, 0, 17, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_CB_CC_values) - offsetof(struct MarioAnimsObj, anim_CB)), (u16 *)(offsetof(struct MarioAnimsObj, anim_CB_CC_indices) - offsetof(struct MarioAnimsObj, anim_CB)), offsetof(struct MarioAnimsObj, anim_CB_CC_values) + sizeof(gMarioAnims.anim_CB_CC_values) - offsetof(struct MarioAnimsObj, anim_CB), 691, 126},
+{1, 189, 0, 0, 1, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_CB_CC_values) - offsetof(struct MarioAnimsObj, anim_CC)), (u16 *)(offsetof(struct MarioAnimsObj, anim_CB_CC_indices) - offsetof(struct MarioAnimsObj, anim_CC)), offsetof(struct MarioAnimsObj, anim_CB_CC_values) + sizeof(gMarioAnims.anim_CB_CC_values) - offsetof(struct MarioAnimsObj, anim_CC), 691, 126},
+{0},
+{0},
+{1, 189, 0, 0, 63, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_CD_values) - offsetof(struct MarioAnimsObj, anim_CD)), (u16 *)(offsetof(struct MarioAnimsObj, anim_CD_indices) - offsetof(struct MarioAnimsObj, anim_CD)), offsetof(struct MarioAnimsObj, anim_CD_values) + sizeof(gMarioAnims.anim_CD_values) - offsetof(struct MarioAnimsObj, anim_CD), 2592, 126},
+{0},
+{0},
+{1, 189, 0, 0, 18, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_CE_values) - offsetof(struct MarioAnimsObj, anim_CE)), (u16 *)(offsetof(struct MarioAnimsObj, anim_CE_indices) - offsetof(struct MarioAnimsObj, anim_CE)), offsetof(struct MarioAnimsObj, anim_CE_values) + sizeof(gMarioAnims.anim_CE_values) - offsetof(struct MarioAnimsObj, anim_CE), 730, 126},
+{0},
+{0},
+{1, 189, 0, 0, 42, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_CF_values) - offsetof(struct MarioAnimsObj, anim_CF)), (u16 *)(offsetof(struct MarioAnimsObj, anim_CF_indices) - offsetof(struct MarioAnimsObj, anim_CF)), offsetof(struct MarioAnimsObj, anim_CF_values) + sizeof(gMarioAnims.anim_CF_values) - offsetof(struct MarioAnimsObj, anim_CF), 1354, 126},
+{0},
+{0},
+{1, 189, 0, 0, 14, 20, (u16 *)(offsetof(struct MarioAnimsObj, anim_D0_values) - offsetof(struct MarioAnimsObj, anim_D0)), (u16 *)(offsetof(struct MarioAnimsObj, anim_D0_indices) - offsetof(struct MarioAnimsObj, anim_D0)), offsetof(struct MarioAnimsObj, anim_D0_values) + sizeof(gMarioAnims.anim_D0_values) - offsetof(struct MarioAnimsObj, anim_D0), 365, 126},
+{0},
+{0},
+};
+ROM_ASSET_LOAD_MARIO_ANIM(anim_00_indices, gMarioAnims.anim_00_indices,  0x004ec6a8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_00_values, gMarioAnims.anim_00_values,  0x004ec7a4,  2604,  0x00000000,  2604);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_01_02_indices, gMarioAnims.anim_01_02_indices,  0x004ed200,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_01_02_values, gMarioAnims.anim_01_02_values,  0x004ed2fc,  6576,  0x00000000,  6576);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_03_indices, gMarioAnims.anim_03_indices,  0x004eecc4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_03_values, gMarioAnims.anim_03_values,  0x004eedc0,  4372,  0x00000000,  4372);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_04_indices, gMarioAnims.anim_04_indices,  0x004efeec,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_04_values, gMarioAnims.anim_04_values,  0x004effe8,  2264,  0x00000000,  2264);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_05_indices, gMarioAnims.anim_05_indices,  0x004f08d8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_05_values, gMarioAnims.anim_05_values,  0x004f09d4,  5796,  0x00000000,  5796);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_06_indices, gMarioAnims.anim_06_indices,  0x004f2090,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_06_values, gMarioAnims.anim_06_values,  0x004f218c,  892,  0x00000000,  892);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_07_08_indices, gMarioAnims.anim_07_08_indices,  0x004f2538,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_07_08_values, gMarioAnims.anim_07_08_values,  0x004f2634,  1468,  0x00000000,  1468);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_09_indices, gMarioAnims.anim_09_indices,  0x004f2c08,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_09_values, gMarioAnims.anim_09_values,  0x004f2d04,  3052,  0x00000000,  3052);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0A_indices, gMarioAnims.anim_0A_indices,  0x004f3908,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0A_values, gMarioAnims.anim_0A_values,  0x004f3a04,  2544,  0x00000000,  2544);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0B_0C_indices, gMarioAnims.anim_0B_0C_indices,  0x004f4424,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0B_0C_values, gMarioAnims.anim_0B_0C_values,  0x004f4520,  1348,  0x00000000,  1348);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0D_indices, gMarioAnims.anim_0D_indices,  0x004f4a7c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0D_values, gMarioAnims.anim_0D_values,  0x004f4b78,  770,  0x00000000,  770);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0E_indices, gMarioAnims.anim_0E_indices,  0x004f4e94,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0E_values, gMarioAnims.anim_0E_values,  0x004f4f90,  80,  0x00000000,  80);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0F_10_indices, gMarioAnims.anim_0F_10_indices,  0x004f5010,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_0F_10_values, gMarioAnims.anim_0F_10_values,  0x004f510c,  1502,  0x00000000,  1502);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_11_indices, gMarioAnims.anim_11_indices,  0x004f5704,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_11_values, gMarioAnims.anim_11_values,  0x004f5800,  1174,  0x00000000,  1174);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_12_indices, gMarioAnims.anim_12_indices,  0x004f5cb0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_12_values, gMarioAnims.anim_12_values,  0x004f5dac,  1318,  0x00000000,  1318);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_13_indices, gMarioAnims.anim_13_indices,  0x004f62ec,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_13_values, gMarioAnims.anim_13_values,  0x004f63e8,  1678,  0x00000000,  1678);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_14_indices, gMarioAnims.anim_14_indices,  0x004f6a90,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_14_values, gMarioAnims.anim_14_values,  0x004f6b8c,  1102,  0x00000000,  1102);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_15_indices, gMarioAnims.anim_15_indices,  0x004f6ff4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_15_values, gMarioAnims.anim_15_values,  0x004f70f0,  930,  0x00000000,  930);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_16_indices, gMarioAnims.anim_16_indices,  0x004f74ac,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_16_values, gMarioAnims.anim_16_values,  0x004f75a8,  4452,  0x00000000,  4452);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_17_indices, gMarioAnims.anim_17_indices,  0x004f8724,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_17_values, gMarioAnims.anim_17_values,  0x004f8820,  2942,  0x00000000,  2942);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_18_indices, gMarioAnims.anim_18_indices,  0x004f74ac,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_18_values, gMarioAnims.anim_18_values,  0x004f94b4,  4452,  0x00000000,  4452);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_19_indices, gMarioAnims.anim_19_indices,  0x004fa630,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_19_values, gMarioAnims.anim_19_values,  0x004fa72c,  5354,  0x00000000,  5354);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1A_indices, gMarioAnims.anim_1A_indices,  0x004fbc30,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1A_values, gMarioAnims.anim_1A_values,  0x004fbd2c,  1146,  0x00000000,  1146);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1B_indices, gMarioAnims.anim_1B_indices,  0x004fc1c0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1B_values, gMarioAnims.anim_1B_values,  0x004fc2bc,  2858,  0x00000000,  2858);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1C_indices, gMarioAnims.anim_1C_indices,  0x004fce00,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1C_values, gMarioAnims.anim_1C_values,  0x004fcefc,  780,  0x00000000,  780);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1D_indices, gMarioAnims.anim_1D_indices,  0x004fd220,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1D_values, gMarioAnims.anim_1D_values,  0x004fd31c,  1380,  0x00000000,  1380);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1E_indices, gMarioAnims.anim_1E_indices,  0x004fd898,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1E_values, gMarioAnims.anim_1E_values,  0x004fd994,  1530,  0x00000000,  1530);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1F_indices, gMarioAnims.anim_1F_indices,  0x004fdfa8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_1F_values, gMarioAnims.anim_1F_values,  0x004fe0a4,  846,  0x00000000,  846);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_20_indices, gMarioAnims.anim_20_indices,  0x004fe40c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_20_values, gMarioAnims.anim_20_values,  0x004fe508,  7124,  0x00000000,  7124);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_21_indices, gMarioAnims.anim_21_indices,  0x005000f4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_21_values, gMarioAnims.anim_21_values,  0x005001f0,  2610,  0x00000000,  2610);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_22_indices, gMarioAnims.anim_22_indices,  0x00500c3c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_22_values, gMarioAnims.anim_22_values,  0x00500d38,  1750,  0x00000000,  1750);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_23_indices, gMarioAnims.anim_23_indices,  0x00501428,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_23_values, gMarioAnims.anim_23_values,  0x00501524,  8216,  0x00000000,  8216);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_24_indices, gMarioAnims.anim_24_indices,  0x00503554,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_24_values, gMarioAnims.anim_24_values,  0x00503650,  9376,  0x00000000,  9376);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_25_indices, gMarioAnims.anim_25_indices,  0x00505b08,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_25_values, gMarioAnims.anim_25_values,  0x00505c04,  8018,  0x00000000,  8018);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_26_indices, gMarioAnims.anim_26_indices,  0x00507b70,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_26_values, gMarioAnims.anim_26_values,  0x00507c6c,  7352,  0x00000000,  7352);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_27_indices, gMarioAnims.anim_27_indices,  0x0050993c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_27_values, gMarioAnims.anim_27_values,  0x00509a38,  8980,  0x00000000,  8980);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_28_indices, gMarioAnims.anim_28_indices,  0x0050bd64,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_28_values, gMarioAnims.anim_28_values,  0x0050be60,  1010,  0x00000000,  1010);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_29_indices, gMarioAnims.anim_29_indices,  0x0050c26c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_29_values, gMarioAnims.anim_29_values,  0x0050c368,  582,  0x00000000,  582);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2A_indices, gMarioAnims.anim_2A_indices,  0x0050c5c8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2A_values, gMarioAnims.anim_2A_values,  0x0050c6c4,  1252,  0x00000000,  1252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2B_indices, gMarioAnims.anim_2B_indices,  0x0050cbc0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2B_values, gMarioAnims.anim_2B_values,  0x0050ccbc,  1582,  0x00000000,  1582);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2C_2D_indices, gMarioAnims.anim_2C_2D_indices,  0x0050d31c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2C_2D_values, gMarioAnims.anim_2C_2D_values,  0x0050d418,  5620,  0x00000000,  5620);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2E_indices, gMarioAnims.anim_2E_indices,  0x0050ea24,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2E_values, gMarioAnims.anim_2E_values,  0x0050eb20,  3028,  0x00000000,  3028);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2F_indices, gMarioAnims.anim_2F_indices,  0x0050f70c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_2F_values, gMarioAnims.anim_2F_values,  0x0050f808,  7420,  0x00000000,  7420);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_30_indices, gMarioAnims.anim_30_indices,  0x0051151c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_30_values, gMarioAnims.anim_30_values,  0x00511618,  5428,  0x00000000,  5428);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_31_indices, gMarioAnims.anim_31_indices,  0x00512b64,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_31_values, gMarioAnims.anim_31_values,  0x00512c60,  10660,  0x00000000,  10660);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_32_indices, gMarioAnims.anim_32_indices,  0x0051561c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_32_values, gMarioAnims.anim_32_values,  0x00515718,  7890,  0x00000000,  7890);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_33_indices, gMarioAnims.anim_33_indices,  0x00517604,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_33_values, gMarioAnims.anim_33_values,  0x00517700,  2840,  0x00000000,  2840);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_34_indices, gMarioAnims.anim_34_indices,  0x00518230,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_34_values, gMarioAnims.anim_34_values,  0x0051832c,  1300,  0x00000000,  1300);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_35_indices, gMarioAnims.anim_35_indices,  0x00518858,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_35_values, gMarioAnims.anim_35_values,  0x00518954,  3704,  0x00000000,  3704);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_36_indices, gMarioAnims.anim_36_indices,  0x005197e4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_36_values, gMarioAnims.anim_36_values,  0x005198e0,  3700,  0x00000000,  3700);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_37_indices, gMarioAnims.anim_37_indices,  0x0051a76c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_37_values, gMarioAnims.anim_37_values,  0x0051a868,  6828,  0x00000000,  6828);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_38_indices, gMarioAnims.anim_38_indices,  0x0051c32c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_38_values, gMarioAnims.anim_38_values,  0x0051c428,  844,  0x00000000,  844);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_39_indices, gMarioAnims.anim_39_indices,  0x0051c78c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_39_values, gMarioAnims.anim_39_values,  0x0051c888,  12418,  0x00000000,  12418);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3A_indices, gMarioAnims.anim_3A_indices,  0x0051f924,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3A_values, gMarioAnims.anim_3A_values,  0x0051fa20,  374,  0x00000000,  374);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3B_indices, gMarioAnims.anim_3B_indices,  0x0051fbb0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3B_values, gMarioAnims.anim_3B_values,  0x0051fcac,  1204,  0x00000000,  1204);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3C_3D_indices, gMarioAnims.anim_3C_3D_indices,  0x00520190,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3C_3D_values, gMarioAnims.anim_3C_3D_values,  0x0052028c,  774,  0x00000000,  774);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3E_indices, gMarioAnims.anim_3E_indices,  0x005205ac,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3E_values, gMarioAnims.anim_3E_values,  0x005206a8,  11490,  0x00000000,  11490);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3F_indices, gMarioAnims.anim_3F_indices,  0x005233a4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_3F_values, gMarioAnims.anim_3F_values,  0x005234a0,  3094,  0x00000000,  3094);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_40_indices, gMarioAnims.anim_40_indices,  0x005240d0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_40_values, gMarioAnims.anim_40_values,  0x005241cc,  1094,  0x00000000,  1094);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_41_indices, gMarioAnims.anim_41_indices,  0x0052462c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_41_values, gMarioAnims.anim_41_values,  0x00524728,  536,  0x00000000,  536);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_42_indices, gMarioAnims.anim_42_indices,  0x00524958,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_42_values, gMarioAnims.anim_42_values,  0x00524a54,  956,  0x00000000,  956);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_43_indices, gMarioAnims.anim_43_indices,  0x00524e28,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_43_values, gMarioAnims.anim_43_values,  0x00524f24,  84,  0x00000000,  84);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_44_indices, gMarioAnims.anim_44_indices,  0x00524f90,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_44_values, gMarioAnims.anim_44_values,  0x0052508c,  650,  0x00000000,  650);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_45_46_indices, gMarioAnims.anim_45_46_indices,  0x00525348,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_45_46_values, gMarioAnims.anim_45_46_values,  0x00525444,  1190,  0x00000000,  1190);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_47_indices, gMarioAnims.anim_47_indices,  0x00525904,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_47_values, gMarioAnims.anim_47_values,  0x00525a00,  838,  0x00000000,  838);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_48_indices, gMarioAnims.anim_48_indices,  0x00525d60,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_48_values, gMarioAnims.anim_48_values,  0x00525e5c,  5098,  0x00000000,  5098);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_49_indices, gMarioAnims.anim_49_indices,  0x00527260,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_49_values, gMarioAnims.anim_49_values,  0x0052735c,  1298,  0x00000000,  1298);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4A_indices, gMarioAnims.anim_4A_indices,  0x00527888,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4A_values, gMarioAnims.anim_4A_values,  0x00527984,  616,  0x00000000,  616);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4B_indices, gMarioAnims.anim_4B_indices,  0x00527c04,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4B_values, gMarioAnims.anim_4B_values,  0x00527d00,  1386,  0x00000000,  1386);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4C_indices, gMarioAnims.anim_4C_indices,  0x00528284,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4C_values, gMarioAnims.anim_4C_values,  0x00528380,  670,  0x00000000,  670);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4D_4E_indices, gMarioAnims.anim_4D_4E_indices,  0x00528650,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4D_4E_values, gMarioAnims.anim_4D_4E_values,  0x0052874c,  2456,  0x00000000,  2456);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4F_indices, gMarioAnims.anim_4F_indices,  0x005290fc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_4F_values, gMarioAnims.anim_4F_values,  0x005291f8,  1578,  0x00000000,  1578);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_50_indices, gMarioAnims.anim_50_indices,  0x0052983c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_50_values, gMarioAnims.anim_50_values,  0x00529938,  420,  0x00000000,  420);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_51_indices, gMarioAnims.anim_51_indices,  0x00529af4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_51_values, gMarioAnims.anim_51_values,  0x00529bf0,  1002,  0x00000000,  1002);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_52_indices, gMarioAnims.anim_52_indices,  0x00529ff4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_52_values, gMarioAnims.anim_52_values,  0x0052a0f0,  878,  0x00000000,  878);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_53_indices, gMarioAnims.anim_53_indices,  0x0052a478,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_53_values, gMarioAnims.anim_53_values,  0x0052a574,  1970,  0x00000000,  1970);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_54_indices, gMarioAnims.anim_54_indices,  0x0052ad40,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_54_values, gMarioAnims.anim_54_values,  0x0052ae3c,  1314,  0x00000000,  1314);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_55_indices, gMarioAnims.anim_55_indices,  0x0052b378,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_55_values, gMarioAnims.anim_55_values,  0x0052b474,  11268,  0x00000000,  11268);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_56_57_indices, gMarioAnims.anim_56_57_indices,  0x0052e0a8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_56_57_values, gMarioAnims.anim_56_57_values,  0x0052e1a4,  1560,  0x00000000,  1560);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_58_indices, gMarioAnims.anim_58_indices,  0x0052e7d4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_58_values, gMarioAnims.anim_58_values,  0x0052e8d0,  1082,  0x00000000,  1082);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_59_indices, gMarioAnims.anim_59_indices,  0x0052ed24,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_59_values, gMarioAnims.anim_59_values,  0x0052ee20,  3052,  0x00000000,  3052);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5A_indices, gMarioAnims.anim_5A_indices,  0x0052fa24,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5A_values, gMarioAnims.anim_5A_values,  0x0052fb20,  3278,  0x00000000,  3278);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5B_indices, gMarioAnims.anim_5B_indices,  0x00530808,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5B_values, gMarioAnims.anim_5B_values,  0x00530904,  720,  0x00000000,  720);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5C_indices, gMarioAnims.anim_5C_indices,  0x00530bec,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5C_values, gMarioAnims.anim_5C_values,  0x00530ce8,  1258,  0x00000000,  1258);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5D_indices, gMarioAnims.anim_5D_indices,  0x005311ec,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5D_values, gMarioAnims.anim_5D_values,  0x005312e8,  1142,  0x00000000,  1142);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5E_indices, gMarioAnims.anim_5E_indices,  0x00531778,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5E_values, gMarioAnims.anim_5E_values,  0x00531874,  12110,  0x00000000,  12110);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5F_indices, gMarioAnims.anim_5F_indices,  0x005347dc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_5F_values, gMarioAnims.anim_5F_values,  0x005348d8,  5058,  0x00000000,  5058);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_60_indices, gMarioAnims.anim_60_indices,  0x00535cb4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_60_values, gMarioAnims.anim_60_values,  0x00535db0,  4020,  0x00000000,  4020);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_61_indices, gMarioAnims.anim_61_indices,  0x00536d7c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_61_values, gMarioAnims.anim_61_values,  0x00536e78,  12660,  0x00000000,  12660);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_62_indices, gMarioAnims.anim_62_indices,  0x0053a004,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_62_values, gMarioAnims.anim_62_values,  0x0053a100,  742,  0x00000000,  742);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_63_indices, gMarioAnims.anim_63_indices,  0x0053a400,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_63_values, gMarioAnims.anim_63_values,  0x0053a4fc,  1626,  0x00000000,  1626);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_64_indices, gMarioAnims.anim_64_indices,  0x0053ab70,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_64_values, gMarioAnims.anim_64_values,  0x0053ac6c,  1246,  0x00000000,  1246);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_65_indices, gMarioAnims.anim_65_indices,  0x0053b164,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_65_values, gMarioAnims.anim_65_values,  0x0053b260,  1700,  0x00000000,  1700);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_66_indices, gMarioAnims.anim_66_indices,  0x0053b91c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_66_values, gMarioAnims.anim_66_values,  0x0053ba18,  1948,  0x00000000,  1948);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_67_indices, gMarioAnims.anim_67_indices,  0x0053c1cc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_67_values, gMarioAnims.anim_67_values,  0x0053c2c8,  386,  0x00000000,  386);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_68_indices, gMarioAnims.anim_68_indices,  0x0053c464,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_68_values, gMarioAnims.anim_68_values,  0x0053c560,  340,  0x00000000,  340);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_69_indices, gMarioAnims.anim_69_indices,  0x0053c6cc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_69_values, gMarioAnims.anim_69_values,  0x0053c7c8,  764,  0x00000000,  764);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6A_indices, gMarioAnims.anim_6A_indices,  0x0053cadc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6A_values, gMarioAnims.anim_6A_values,  0x0053cbd8,  1060,  0x00000000,  1060);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6B_indices, gMarioAnims.anim_6B_indices,  0x0053d014,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6B_values, gMarioAnims.anim_6B_values,  0x0053d110,  940,  0x00000000,  940);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6C_indices, gMarioAnims.anim_6C_indices,  0x0053d4d4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6C_values, gMarioAnims.anim_6C_values,  0x0053d5d0,  1284,  0x00000000,  1284);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6D_indices, gMarioAnims.anim_6D_indices,  0x0053daec,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6D_values, gMarioAnims.anim_6D_values,  0x0053dbe8,  1286,  0x00000000,  1286);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6E_indices, gMarioAnims.anim_6E_indices,  0x0053e108,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6E_values, gMarioAnims.anim_6E_values,  0x0053e204,  1136,  0x00000000,  1136);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6F_70_indices, gMarioAnims.anim_6F_70_indices,  0x0053e6a4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_6F_70_values, gMarioAnims.anim_6F_70_values,  0x0053e7a0,  98,  0x00000000,  98);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_71_indices, gMarioAnims.anim_71_indices,  0x0053e81c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_71_values, gMarioAnims.anim_71_values,  0x0053e918,  2078,  0x00000000,  2078);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_72_73_indices, gMarioAnims.anim_72_73_indices,  0x0053f168,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_72_73_values, gMarioAnims.anim_72_73_values,  0x0053f264,  4342,  0x00000000,  4342);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_74_indices, gMarioAnims.anim_74_indices,  0x00540374,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_74_values, gMarioAnims.anim_74_values,  0x00540470,  1844,  0x00000000,  1844);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_75_indices, gMarioAnims.anim_75_indices,  0x00540bbc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_75_values, gMarioAnims.anim_75_values,  0x00540cb8,  1892,  0x00000000,  1892);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_76_indices, gMarioAnims.anim_76_indices,  0x00541434,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_76_values, gMarioAnims.anim_76_values,  0x00541530,  4648,  0x00000000,  4648);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_77_indices, gMarioAnims.anim_77_indices,  0x00542770,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_77_values, gMarioAnims.anim_77_values,  0x0054286c,  2464,  0x00000000,  2464);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_78_indices, gMarioAnims.anim_78_indices,  0x00543224,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_78_values, gMarioAnims.anim_78_values,  0x00543320,  10454,  0x00000000,  10454);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_79_indices, gMarioAnims.anim_79_indices,  0x00545c10,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_79_values, gMarioAnims.anim_79_values,  0x00545d0c,  3634,  0x00000000,  3634);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7A_indices, gMarioAnims.anim_7A_indices,  0x00546b58,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7A_values, gMarioAnims.anim_7A_values,  0x00546c54,  402,  0x00000000,  402);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7B_indices, gMarioAnims.anim_7B_indices,  0x00546e00,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7B_values, gMarioAnims.anim_7B_values,  0x00546efc,  2360,  0x00000000,  2360);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7C_indices, gMarioAnims.anim_7C_indices,  0x0054784c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7C_values, gMarioAnims.anim_7C_values,  0x00547948,  2300,  0x00000000,  2300);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7D_indices, gMarioAnims.anim_7D_indices,  0x0054825c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7D_values, gMarioAnims.anim_7D_values,  0x00548358,  1114,  0x00000000,  1114);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7E_indices, gMarioAnims.anim_7E_indices,  0x005487cc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7E_values, gMarioAnims.anim_7E_values,  0x005488c8,  4538,  0x00000000,  4538);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7F_indices, gMarioAnims.anim_7F_indices,  0x00549a9c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_7F_values, gMarioAnims.anim_7F_values,  0x00549b98,  3622,  0x00000000,  3622);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_80_indices, gMarioAnims.anim_80_indices,  0x0054a9d8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_80_values, gMarioAnims.anim_80_values,  0x0054aad4,  4248,  0x00000000,  4248);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_81_indices, gMarioAnims.anim_81_indices,  0x0054bb84,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_81_values, gMarioAnims.anim_81_values,  0x0054bc80,  4308,  0x00000000,  4308);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_82_indices, gMarioAnims.anim_82_indices,  0x0054cd6c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_82_values, gMarioAnims.anim_82_values,  0x0054ce68,  5770,  0x00000000,  5770);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_83_indices, gMarioAnims.anim_83_indices,  0x0054e50c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_83_values, gMarioAnims.anim_83_values,  0x0054e608,  4734,  0x00000000,  4734);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_84_indices, gMarioAnims.anim_84_indices,  0x0054f8a0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_84_values, gMarioAnims.anim_84_values,  0x0054f99c,  4756,  0x00000000,  4756);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_85_indices, gMarioAnims.anim_85_indices,  0x00550c48,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_85_values, gMarioAnims.anim_85_values,  0x00550d44,  324,  0x00000000,  324);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_86_indices, gMarioAnims.anim_86_indices,  0x00550ea0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_86_values, gMarioAnims.anim_86_values,  0x00550f9c,  2902,  0x00000000,  2902);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_87_indices, gMarioAnims.anim_87_indices,  0x00551b0c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_87_values, gMarioAnims.anim_87_values,  0x00551c08,  1564,  0x00000000,  1564);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_88_89_indices, gMarioAnims.anim_88_89_indices,  0x00552254,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_88_89_values, gMarioAnims.anim_88_89_values,  0x00552350,  1260,  0x00000000,  1260);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8A_indices, gMarioAnims.anim_8A_indices,  0x00552854,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8A_values, gMarioAnims.anim_8A_values,  0x00552950,  2980,  0x00000000,  2980);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8B_indices, gMarioAnims.anim_8B_indices,  0x0055350c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8B_values, gMarioAnims.anim_8B_values,  0x00553608,  2970,  0x00000000,  2970);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8C_indices, gMarioAnims.anim_8C_indices,  0x005541bc,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8C_values, gMarioAnims.anim_8C_values,  0x005542b8,  646,  0x00000000,  646);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8D_indices, gMarioAnims.anim_8D_indices,  0x00554558,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8D_values, gMarioAnims.anim_8D_values,  0x00554654,  1086,  0x00000000,  1086);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8E_8F_indices, gMarioAnims.anim_8E_8F_indices,  0x00554ac4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_8E_8F_values, gMarioAnims.anim_8E_8F_values,  0x00554bc0,  1618,  0x00000000,  1618);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_90_indices, gMarioAnims.anim_90_indices,  0x0055522c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_90_values, gMarioAnims.anim_90_values,  0x00555328,  1012,  0x00000000,  1012);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_91_indices, gMarioAnims.anim_91_indices,  0x00555734,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_91_values, gMarioAnims.anim_91_values,  0x00555830,  266,  0x00000000,  266);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_92_indices, gMarioAnims.anim_92_indices,  0x00555954,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_92_values, gMarioAnims.anim_92_values,  0x00555a50,  5600,  0x00000000,  5600);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_93_indices, gMarioAnims.anim_93_indices,  0x00557048,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_93_values, gMarioAnims.anim_93_values,  0x00557144,  602,  0x00000000,  602);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_94_indices, gMarioAnims.anim_94_indices,  0x004f4e94,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_94_values, gMarioAnims.anim_94_values,  0x005574b4,  80,  0x00000000,  80);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_95_indices, gMarioAnims.anim_95_indices,  0x0055751c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_95_values, gMarioAnims.anim_95_values,  0x00557618,  280,  0x00000000,  280);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_96_indices, gMarioAnims.anim_96_indices,  0x00557748,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_96_values, gMarioAnims.anim_96_values,  0x00557844,  680,  0x00000000,  680);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_97_indices, gMarioAnims.anim_97_indices,  0x00557b04,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_97_values, gMarioAnims.anim_97_values,  0x00557c00,  416,  0x00000000,  416);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_98_indices, gMarioAnims.anim_98_indices,  0x00557db8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_98_values, gMarioAnims.anim_98_values,  0x00557eb4,  2758,  0x00000000,  2758);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_99_indices, gMarioAnims.anim_99_indices,  0x00558994,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_99_values, gMarioAnims.anim_99_values,  0x00558a90,  7014,  0x00000000,  7014);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9A_indices, gMarioAnims.anim_9A_indices,  0x0055a610,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9A_values, gMarioAnims.anim_9A_values,  0x0055a70c,  644,  0x00000000,  644);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9B_indices, gMarioAnims.anim_9B_indices,  0x0055a9a8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9B_values, gMarioAnims.anim_9B_values,  0x0055aaa4,  630,  0x00000000,  630);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9C_indices, gMarioAnims.anim_9C_indices,  0x0055ad34,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9C_values, gMarioAnims.anim_9C_values,  0x0055ae30,  4884,  0x00000000,  4884);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9D_indices, gMarioAnims.anim_9D_indices,  0x0055c15c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9D_values, gMarioAnims.anim_9D_values,  0x0055c258,  1944,  0x00000000,  1944);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9E_indices, gMarioAnims.anim_9E_indices,  0x0055ca08,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9E_values, gMarioAnims.anim_9E_values,  0x0055cb04,  4008,  0x00000000,  4008);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9F_indices, gMarioAnims.anim_9F_indices,  0x0055dac4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_9F_values, gMarioAnims.anim_9F_values,  0x0055dbc0,  774,  0x00000000,  774);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A0_indices, gMarioAnims.anim_A0_indices,  0x0055dee0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A0_values, gMarioAnims.anim_A0_values,  0x0055dfdc,  390,  0x00000000,  390);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A1_indices, gMarioAnims.anim_A1_indices,  0x0055e17c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A1_values, gMarioAnims.anim_A1_values,  0x0055e278,  920,  0x00000000,  920);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A2_indices, gMarioAnims.anim_A2_indices,  0x0055e628,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A2_values, gMarioAnims.anim_A2_values,  0x0055e724,  1448,  0x00000000,  1448);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A3_indices, gMarioAnims.anim_A3_indices,  0x0055ece4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A3_values, gMarioAnims.anim_A3_values,  0x0055ede0,  2590,  0x00000000,  2590);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A4_indices, gMarioAnims.anim_A4_indices,  0x0055f818,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A4_values, gMarioAnims.anim_A4_values,  0x0055f914,  1650,  0x00000000,  1650);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A5_indices, gMarioAnims.anim_A5_indices,  0x0055ffa0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A5_values, gMarioAnims.anim_A5_values,  0x0056009c,  5148,  0x00000000,  5148);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A6_indices, gMarioAnims.anim_A6_indices,  0x005614d0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A6_values, gMarioAnims.anim_A6_values,  0x005615cc,  4646,  0x00000000,  4646);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A7_indices, gMarioAnims.anim_A7_indices,  0x0056280c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A7_values, gMarioAnims.anim_A7_values,  0x00562908,  3060,  0x00000000,  3060);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A8_indices, gMarioAnims.anim_A8_indices,  0x00563514,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A8_values, gMarioAnims.anim_A8_values,  0x00563610,  3910,  0x00000000,  3910);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A9_indices, gMarioAnims.anim_A9_indices,  0x00564570,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_A9_values, gMarioAnims.anim_A9_values,  0x0056466c,  1728,  0x00000000,  1728);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AA_indices, gMarioAnims.anim_AA_indices,  0x00564d44,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AA_values, gMarioAnims.anim_AA_values,  0x00564e40,  972,  0x00000000,  972);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AB_indices, gMarioAnims.anim_AB_indices,  0x00565224,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AB_values, gMarioAnims.anim_AB_values,  0x00565320,  750,  0x00000000,  750);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AC_indices, gMarioAnims.anim_AC_indices,  0x00565628,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AC_values, gMarioAnims.anim_AC_values,  0x00565724,  1706,  0x00000000,  1706);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AD_indices, gMarioAnims.anim_AD_indices,  0x00565de8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AD_values, gMarioAnims.anim_AD_values,  0x00565ee4,  1860,  0x00000000,  1860);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AE_indices, gMarioAnims.anim_AE_indices,  0x00566640,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AE_values, gMarioAnims.anim_AE_values,  0x0056673c,  956,  0x00000000,  956);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AF_indices, gMarioAnims.anim_AF_indices,  0x00566b10,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_AF_values, gMarioAnims.anim_AF_values,  0x00566c0c,  2160,  0x00000000,  2160);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B0_indices, gMarioAnims.anim_B0_indices,  0x00567494,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B0_values, gMarioAnims.anim_B0_values,  0x00567590,  440,  0x00000000,  440);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B1_indices, gMarioAnims.anim_B1_indices,  0x00567760,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B1_values, gMarioAnims.anim_B1_values,  0x0056785c,  2418,  0x00000000,  2418);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B2_indices, gMarioAnims.anim_B2_indices,  0x005681e8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B2_values, gMarioAnims.anim_B2_values,  0x005682e4,  1824,  0x00000000,  1824);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B3_indices, gMarioAnims.anim_B3_indices,  0x00568a1c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B3_values, gMarioAnims.anim_B3_values,  0x00568b18,  6494,  0x00000000,  6494);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B4_indices, gMarioAnims.anim_B4_indices,  0x0056a490,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B4_values, gMarioAnims.anim_B4_values,  0x0056a58c,  1846,  0x00000000,  1846);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B5_B6_indices, gMarioAnims.anim_B5_B6_indices,  0x0056acf4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B5_B6_values, gMarioAnims.anim_B5_B6_values,  0x0056adf0,  1382,  0x00000000,  1382);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B7_indices, gMarioAnims.anim_B7_indices,  0x0056b370,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B7_values, gMarioAnims.anim_B7_values,  0x0056b46c,  2980,  0x00000000,  2980);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B8_indices, gMarioAnims.anim_B8_indices,  0x0056c028,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B8_values, gMarioAnims.anim_B8_values,  0x0056c124,  776,  0x00000000,  776);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B9_indices, gMarioAnims.anim_B9_indices,  0x0056c444,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_B9_values, gMarioAnims.anim_B9_values,  0x0056c540,  2068,  0x00000000,  2068);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BA_indices, gMarioAnims.anim_BA_indices,  0x0056cd6c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BA_values, gMarioAnims.anim_BA_values,  0x0056ce68,  986,  0x00000000,  986);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BB_indices, gMarioAnims.anim_BB_indices,  0x0056d25c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BB_values, gMarioAnims.anim_BB_values,  0x0056d358,  4132,  0x00000000,  4132);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BC_BD_indices, gMarioAnims.anim_BC_BD_indices,  0x0056e3ac,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BC_BD_values, gMarioAnims.anim_BC_BD_values,  0x0056e4a8,  1528,  0x00000000,  1528);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BE_indices, gMarioAnims.anim_BE_indices,  0x0056eab8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BE_values, gMarioAnims.anim_BE_values,  0x0056ebb4,  760,  0x00000000,  760);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BF_indices, gMarioAnims.anim_BF_indices,  0x0056eec4,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_BF_values, gMarioAnims.anim_BF_values,  0x0056efc0,  1936,  0x00000000,  1936);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C0_indices, gMarioAnims.anim_C0_indices,  0x0056f768,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C0_values, gMarioAnims.anim_C0_values,  0x0056f864,  2452,  0x00000000,  2452);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C1_indices, gMarioAnims.anim_C1_indices,  0x00570210,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C1_values, gMarioAnims.anim_C1_values,  0x0057030c,  2468,  0x00000000,  2468);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C2_indices, gMarioAnims.anim_C2_indices,  0x00570cc8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C2_values, gMarioAnims.anim_C2_values,  0x00570dc4,  5422,  0x00000000,  5422);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C3_indices, gMarioAnims.anim_C3_indices,  0x0057230c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C3_values, gMarioAnims.anim_C3_values,  0x00572408,  1942,  0x00000000,  1942);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C4_indices, gMarioAnims.anim_C4_indices,  0x0057230c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C4_values, gMarioAnims.anim_C4_values,  0x00572cb4,  1942,  0x00000000,  1942);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C5_indices, gMarioAnims.anim_C5_indices,  0x0057230c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C5_values, gMarioAnims.anim_C5_values,  0x00573560,  1942,  0x00000000,  1942);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C6_indices, gMarioAnims.anim_C6_indices,  0x00573d10,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C6_values, gMarioAnims.anim_C6_values,  0x00573e0c,  1666,  0x00000000,  1666);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C7_indices, gMarioAnims.anim_C7_indices,  0x005744a8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C7_values, gMarioAnims.anim_C7_values,  0x005745a4,  2844,  0x00000000,  2844);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C8_indices, gMarioAnims.anim_C8_indices,  0x005750d8,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C8_values, gMarioAnims.anim_C8_values,  0x005751d4,  1648,  0x00000000,  1648);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C9_indices, gMarioAnims.anim_C9_indices,  0x0057585c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_C9_values, gMarioAnims.anim_C9_values,  0x00575958,  1940,  0x00000000,  1940);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CA_indices, gMarioAnims.anim_CA_indices,  0x00576104,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CA_values, gMarioAnims.anim_CA_values,  0x00576200,  1998,  0x00000000,  1998);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CB_CC_indices, gMarioAnims.anim_CB_CC_indices,  0x00576a00,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CB_CC_values, gMarioAnims.anim_CB_CC_values,  0x00576afc,  1382,  0x00000000,  1382);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CD_indices, gMarioAnims.anim_CD_indices,  0x0057707c,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CD_values, gMarioAnims.anim_CD_values,  0x00577178,  5184,  0x00000000,  5184);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CE_indices, gMarioAnims.anim_CE_indices,  0x005785d0,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CE_values, gMarioAnims.anim_CE_values,  0x005786cc,  1460,  0x00000000,  1460);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CF_indices, gMarioAnims.anim_CF_indices,  0x00578c98,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_CF_values, gMarioAnims.anim_CF_values,  0x00578d94,  2708,  0x00000000,  2708);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_D0_indices, gMarioAnims.anim_D0_indices,  0x00579840,  252,  0x00000000,  252);
+ROM_ASSET_LOAD_MARIO_ANIM(anim_D0_values, gMarioAnims.anim_D0_values,  0x0057993c,  730,  0x00000000,  730);
@@ -0,0 +1,1201 @@
+MARIO_ANIM_CS_MENU = "mario_anim_cs_menu"
+smlua_anim_util_register_animation(MARIO_ANIM_CS_MENU,
+	0,
+	0,
+	0,
+	0,
+	83,
+	{ 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 
+	0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 
+	0xFFFD, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFB, 
+	0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 
+	0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFB, 0xFFFC, 0xFFFC, 0xFFFC, 0xFFFC, 
+	0xFFFC, 0xFFFC, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 
+	0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x00AD, 0x00AD, 0x00AD, 0x00AC, 
+	0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AB, 0x00AB, 0x00AB, 
+	0x00AB, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00A9, 0x00A9, 0x00A9, 0x00A8, 
+	0x00A8, 0x00A8, 0x00A8, 0x00A7, 0x00A7, 0x00A7, 0x00A6, 0x00A6, 0x00A6, 
+	0x00A6, 0x00A5, 0x00A5, 0x00A5, 0x00A5, 0x00A5, 0x00A5, 0x00A4, 0x00A4, 
+	0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A4, 0x00A5, 0x00A5, 
+	0x00A5, 0x00A5, 0x00A5, 0x00A5, 0x00A6, 0x00A6, 0x00A6, 0x00A6, 0x00A7, 
+	0x00A7, 0x00A7, 0x00A8, 0x00A8, 0x00A8, 0x00A8, 0x00A9, 0x00A9, 0x00A9, 
+	0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AB, 0x00AB, 0x00AB, 0x00AB, 0x00AC, 
+	0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AC, 0x00AD, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFD, 
+	0xFFFD, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFFB, 0xFFFA, 0xFFFA, 0xFFF9, 0xFFF8, 
+	0xFFF8, 0xFFF7, 0xFFF7, 0xFFF6, 0xFFF5, 0xFFF5, 0xFFF4, 0xFFF4, 0xFFF3, 
+	0xFFF2, 0xFFF2, 0xFFF1, 0xFFF1, 0xFFF1, 0xFFF0, 0xFFF0, 0xFFEF, 0xFFEF, 
+	0xFFEF, 0xFFEF, 0xFFEF, 0xFFEE, 0xFFEE, 0xFFEE, 0xFFEF, 0xFFEF, 0xFFEF, 
+	0xFFEF, 0xFFEF, 0xFFF0, 0xFFF0, 0xFFF1, 0xFFF1, 0xFFF1, 0xFFF2, 0xFFF2, 
+	0xFFF3, 0xFFF4, 0xFFF4, 0xFFF5, 0xFFF5, 0xFFF6, 0xFFF7, 0xFFF7, 0xFFF8, 
+	0xFFF8, 0xFFF9, 0xFFFA, 0xFFFA, 0xFFFB, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFD, 
+	0xFFFD, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x3FFF, 
+	0x0000, 0xDC72, 0x007B, 0x4067, 0xF96D, 0xF96D, 0xF96D, 0xF96D, 0xF96C, 
+	0xF96B, 0xF96A, 0xF96A, 0xF968, 0xF967, 0xF966, 0xF965, 0xF963, 0xF962, 
+	0xF960, 0xF95E, 0xF95D, 0xF95B, 0xF959, 0xF957, 0xF956, 0xF954, 0xF952, 
+	0xF950, 0xF94E, 0xF94D, 0xF94B, 0xF949, 0xF948, 0xF946, 0xF945, 0xF943, 
+	0xF942, 0xF940, 0xF93F, 0xF93E, 0xF93D, 0xF93C, 0xF93C, 0xF93B, 0xF93B, 
+	0xF93A, 0xF93A, 0xF93A, 0xF93B, 0xF93B, 0xF93C, 0xF93C, 0xF93D, 0xF93E, 
+	0xF93F, 0xF940, 0xF942, 0xF943, 0xF945, 0xF946, 0xF948, 0xF949, 0xF94B, 
+	0xF94D, 0xF94E, 0xF950, 0xF952, 0xF954, 0xF956, 0xF957, 0xF959, 0xF95B, 
+	0xF95D, 0xF95E, 0xF960, 0xF962, 0xF963, 0xF965, 0xF966, 0xF967, 0xF968, 
+	0xF96A, 0xF96A, 0xF96B, 0xF96C, 0xF96D, 0xFE3D, 0xFE3D, 0xFE3F, 0xFE41, 
+	0xFE44, 0xFE48, 0xFE4D, 0xFE52, 0xFE58, 0xFE5F, 0xFE66, 0xFE6D, 0xFE76, 
+	0xFE7E, 0xFE87, 0xFE90, 0xFE9A, 0xFEA3, 0xFEAD, 0xFEB7, 0xFEC1, 0xFECC, 
+	0xFED6, 0xFEE0, 0xFEEA, 0xFEF4, 0xFEFD, 0xFF07, 0xFF10, 0xFF19, 0xFF22, 
+	0xFF2A, 0xFF31, 0xFF38, 0xFF3F, 0xFF45, 0xFF4A, 0xFF4F, 0xFF53, 0xFF56, 
+	0xFF58, 0xFF5A, 0xFF5A, 0xFF5A, 0xFF58, 0xFF56, 0xFF53, 0xFF4F, 0xFF4A, 
+	0xFF45, 0xFF3F, 0xFF38, 0xFF31, 0xFF2A, 0xFF22, 0xFF19, 0xFF10, 0xFF07, 
+	0xFEFD, 0xFEF4, 0xFEEA, 0xFEE0, 0xFED6, 0xFECC, 0xFEC1, 0xFEB7, 0xFEAD, 
+	0xFEA3, 0xFE9A, 0xFE90, 0xFE87, 0xFE7E, 0xFE76, 0xFE6D, 0xFE66, 0xFE5F, 
+	0xFE58, 0xFE52, 0xFE4D, 0xFE48, 0xFE44, 0xFE41, 0xFE3F, 0xFE3D, 0xF4CE, 
+	0xF4D1, 0xF4DA, 0xF4E8, 0xF4FA, 0xF512, 0xF52E, 0xF54E, 0xF572, 0xF59A, 
+	0xF5C5, 0xF5F3, 0xF624, 0xF657, 0xF68D, 0xF6C5, 0xF6FE, 0xF739, 0xF774, 
+	0xF7B1, 0xF7EE, 0xF82C, 0xF869, 0xF8A6, 0xF8E3, 0xF91F, 0xF95A, 0xF993, 
+	0xF9CB, 0xFA00, 0xFA34, 0xFA65, 0xFA93, 0xFABE, 0xFAE6, 0xFB0A, 0xFB2A, 
+	0xFB46, 0xFB5D, 0xFB70, 0xFB7E, 0xFB86, 0xFB89, 0xFB86, 0xFB7E, 0xFB70, 
+	0xFB5D, 0xFB46, 0xFB2A, 0xFB0A, 0xFAE6, 0xFABE, 0xFA93, 0xFA65, 0xFA34, 
+	0xFA00, 0xF9CB, 0xF993, 0xF95A, 0xF91F, 0xF8E3, 0xF8A6, 0xF869, 0xF82C, 
+	0xF7EE, 0xF7B1, 0xF774, 0xF739, 0xF6FE, 0xF6C5, 0xF68D, 0xF657, 0xF624, 
+	0xF5F3, 0xF5C5, 0xF59A, 0xF572, 0xF54E, 0xF52E, 0xF512, 0xF4FA, 0xF4E8, 
+	0xF4DA, 0xF4D1, 0x0BA2, 0x0BA3, 0x0BA6, 0x0BAB, 0x0BB2, 0x0BBA, 0x0BC3, 
+	0x0BCD, 0x0BD7, 0x0BE2, 0x0BED, 0x0BF9, 0x0C04, 0x0C0E, 0x0C18, 0x0C21, 
+	0x0C29, 0x0C30, 0x0C34, 0x0C38, 0x0C39, 0x0C38, 0x0C37, 0x0C34, 0x0C31, 
+	0x0C2D, 0x0C28, 0x0C22, 0x0C1C, 0x0C15, 0x0C0E, 0x0C06, 0x0BFD, 0x0BF4, 
+	0x0BEB, 0x0BE2, 0x0BD8, 0x0BCE, 0x0BC4, 0x0BB9, 0x0BAF, 0x0BA5, 0x0B9B, 
+	0x0B90, 0x0B86, 0x0B7D, 0x0B73, 0x0B6A, 0x0B61, 0x0B59, 0x0B51, 0x0B49, 
+	0x0B42, 0x0B3C, 0x0B36, 0x0B31, 0x0B2D, 0x0B2A, 0x0B28, 0x0B26, 0x0B26, 
+	0x0B26, 0x0B28, 0x0B2B, 0x0B2F, 0x0B34, 0x0B39, 0x0B3F, 0x0B46, 0x0B4D, 
+	0x0B54, 0x0B5C, 0x0B64, 0x0B6C, 0x0B73, 0x0B7B, 0x0B82, 0x0B89, 0x0B8F, 
+	0x0B94, 0x0B99, 0x0B9D, 0x0BA0, 0x0BA2, 0xFA5B, 0xFA5E, 0xFA66, 0xFA74, 
+	0xFA86, 0xFA9B, 0xFAB4, 0xFACF, 0xFAEC, 0xFB0A, 0xFB29, 0xFB48, 0xFB66, 
+	0xFB83, 0xFB9E, 0xFBB7, 0xFBCD, 0xFBDF, 0xFBEC, 0xFBF5, 0xFBF8, 0xFBF6, 
+	0xFBF3, 0xFBED, 0xFBE5, 0xFBDC, 0xFBD0, 0xFBC3, 0xFBB4, 0xFBA4, 0xFB92, 
+	0xFB7F, 0xFB6B, 0xFB56, 0xFB41, 0xFB2A, 0xFB13, 0xFAFB, 0xFAE3, 0xFACB, 
+	0xFAB3, 0xFA9A, 0xFA82, 0xFA6A, 0xFA53, 0xFA3B, 0xFA25, 0xFA0F, 0xF9FA, 
+	0xF9E6, 0xF9D3, 0xF9C2, 0xF9B1, 0xF9A3, 0xF995, 0xF98A, 0xF980, 0xF978, 
+	0xF973, 0xF96F, 0xF96E, 0xF96F, 0xF972, 0xF978, 0xF97F, 0xF988, 0xF993, 
+	0xF99F, 0xF9AB, 0xF9B9, 0xF9C7, 0xF9D6, 0xF9E4, 0xF9F3, 0xFA02, 0xFA10, 
+	0xFA1D, 0xFA2A, 0xFA36, 0xFA40, 0xFA49, 0xFA51, 0xFA56, 0xFA5A, 0x0691, 
+	0x0687, 0x066B, 0x063E, 0x0603, 0x05BC, 0x056B, 0x0511, 0x04B1, 0x044E, 
+	0x03E8, 0x0382, 0x031E, 0x02BF, 0x0265, 0x0214, 0x01CD, 0x0192, 0x0165, 
+	0x0149, 0x013F, 0x0143, 0x014F, 0x0162, 0x017C, 0x019D, 0x01C4, 0x01F1, 
+	0x0223, 0x025B, 0x0296, 0x02D6, 0x0319, 0x0360, 0x03AA, 0x03F6, 0x0444, 
+	0x0494, 0x04E5, 0x0537, 0x0589, 0x05DC, 0x062D, 0x067E, 0x06CE, 0x071C, 
+	0x0769, 0x07B2, 0x07F9, 0x083C, 0x087C, 0x08B8, 0x08EF, 0x0921, 0x094E, 
+	0x0975, 0x0996, 0x09B0, 0x09C4, 0x09CF, 0x09D3, 0x09CF, 0x09C3, 0x09B0, 
+	0x0996, 0x0976, 0x0951, 0x0928, 0x08FB, 0x08CB, 0x0899, 0x0866, 0x0832, 
+	0x07FE, 0x07CB, 0x0799, 0x0769, 0x073C, 0x0713, 0x06EE, 0x06CF, 0x06B5, 
+	0x06A1, 0x0695, 0x0000, 0xFFFF, 0xBFFF, 0xFBAD, 0xFBAC, 0xFBA9, 0xFBA5, 
+	0xFB9E, 0xFB96, 0xFB8D, 0xFB82, 0xFB76, 0xFB68, 0xFB5A, 0xFB4A, 0xFB3A, 
+	0xFB28, 0xFB16, 0xFB03, 0xFAF0, 0xFADC, 0xFAC8, 0xFAB3, 0xFA9F, 0xFA8A, 
+	0xFA75, 0xFA60, 0xFA4C, 0xFA38, 0xFA24, 0xFA10, 0xF9FE, 0xF9EB, 0xF9DA, 
+	0xF9CA, 0xF9BA, 0xF9AB, 0xF99E, 0xF992, 0xF987, 0xF97D, 0xF975, 0xF96F, 
+	0xF96A, 0xF968, 0xF967, 0xF968, 0xF96A, 0xF96F, 0xF975, 0xF97D, 0xF987, 
+	0xF992, 0xF99E, 0xF9AB, 0xF9BA, 0xF9CA, 0xF9DA, 0xF9EB, 0xF9FE, 0xFA10, 
+	0xFA24, 0xFA38, 0xFA4C, 0xFA60, 0xFA75, 0xFA8A, 0xFA9F, 0xFAB3, 0xFAC8, 
+	0xFADC, 0xFAF0, 0xFB03, 0xFB16, 0xFB28, 0xFB3A, 0xFB4A, 0xFB5A, 0xFB68, 
+	0xFB76, 0xFB82, 0xFB8D, 0xFB96, 0xFB9E, 0xFBA5, 0xFBA9, 0xFBAC, 0xDE3A, 
+	0xDE3A, 0xDE3A, 0xDE3B, 0xDE3C, 0xDE3D, 0xDE3E, 0xDE3F, 0xDE41, 0xDE43, 
+	0xDE44, 0xDE46, 0xDE48, 0xDE4B, 0xDE4D, 0xDE4F, 0xDE52, 0xDE54, 0xDE57, 
+	0xDE59, 0xDE5C, 0xDE5E, 0xDE61, 0xDE63, 0xDE66, 0xDE68, 0xDE6B, 0xDE6D, 
+	0xDE70, 0xDE72, 0xDE74, 0xDE76, 0xDE78, 0xDE7A, 0xDE7C, 0xDE7D, 0xDE7E, 
+	0xDE80, 0xDE81, 0xDE81, 0xDE82, 0xDE82, 0xDE82, 0xDE82, 0xDE82, 0xDE81, 
+	0xDE81, 0xDE80, 0xDE7E, 0xDE7D, 0xDE7C, 0xDE7A, 0xDE78, 0xDE76, 0xDE74, 
+	0xDE72, 0xDE70, 0xDE6D, 0xDE6B, 0xDE68, 0xDE66, 0xDE63, 0xDE61, 0xDE5E, 
+	0xDE5C, 0xDE59, 0xDE56, 0xDE54, 0xDE52, 0xDE4F, 0xDE4D, 0xDE4B, 0xDE48, 
+	0xDE46, 0xDE44, 0xDE43, 0xDE41, 0xDE3F, 0xDE3E, 0xDE3D, 0xDE3C, 0xDE3B, 
+	0xDE3A, 0xE9B3, 0xE9B4, 0xE9B8, 0xE9BF, 0xE9C7, 0xE9D2, 0xE9DF, 0xE9EE, 
+	0xE9FE, 0xEA11, 0xEA24, 0xEA3A, 0xEA50, 0xEA68, 0xEA80, 0xEA9A, 0xEAB4, 
+	0xEACF, 0xEAEB, 0xEB07, 0xEB23, 0xEB3F, 0xEB5C, 0xEB78, 0xEB94, 0xEBAF, 
+	0xEBCA, 0xEBE5, 0xEBFE, 0xEC17, 0xEC2F, 0xEC45, 0xEC5A, 0xEC6E, 0xEC80, 
+	0xEC91, 0xECA0, 0xECAD, 0xECB8, 0xECC0, 0xECC6, 0xECCA, 0xECCC, 0xECCA, 
+	0xECC6, 0xECC0, 0xECB8, 0xECAD, 0xECA0, 0xEC91, 0xEC80, 0xEC6E, 0xEC5A, 
+	0xEC45, 0xEC2F, 0xEC17, 0xEBFE, 0xEBE5, 0xEBCA, 0xEBAF, 0xEB94, 0xEB78, 
+	0xEB5C, 0xEB3F, 0xEB23, 0xEB07, 0xEAEB, 0xEACF, 0xEAB4, 0xEA9A, 0xEA80, 
+	0xEA68, 0xEA50, 0xEA3A, 0xEA24, 0xEA11, 0xE9FE, 0xE9EE, 0xE9DF, 0xE9D2, 
+	0xE9C7, 0xE9BF, 0xE9B8, 0xE9B4, 0xFFFF, 0x0000, 0x0001, 0x0001, 0x0002, 
+	0x0003, 0x0005, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0011, 0x0014, 
+	0x0016, 0x0019, 0x001C, 0x0020, 0x0023, 0x0026, 0x002A, 0x002E, 0x0031, 
+	0x0035, 0x0039, 0x003D, 0x0041, 0x0045, 0x0049, 0x004D, 0x0051, 0x0055, 
+	0x0059, 0x005D, 0x0061, 0x0065, 0x0069, 0x006D, 0x0071, 0x0074, 0x0078, 
+	0x007C, 0x007F, 0x0082, 0x0086, 0x0089, 0x008C, 0x008F, 0x0091, 0x0094, 
+	0x0096, 0x0098, 0x009A, 0x009C, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 
+	0x00A2, 0x00A2, 0x00A1, 0x009F, 0x009B, 0x0096, 0x0090, 0x0089, 0x0081, 
+	0x0078, 0x006F, 0x0065, 0x005B, 0x0051, 0x0047, 0x003D, 0x0033, 0x002A, 
+	0x0021, 0x0019, 0x0012, 0x000C, 0x0007, 0x0003, 0x0001, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFFB, 
+	0xFFFA, 0xFFF9, 0xFFF8, 0xFFF7, 0xFFF6, 0xFFF4, 0xFFF3, 0xFFF2, 0xFFF1, 
+	0xFFEF, 0xFFEE, 0xFFED, 0xFFEB, 0xFFEA, 0xFFE8, 0xFFE7, 0xFFE5, 0xFFE4, 
+	0xFFE2, 0xFFE1, 0xFFDF, 0xFFDE, 0xFFDC, 0xFFDB, 0xFFD9, 0xFFD8, 0xFFD6, 
+	0xFFD5, 0xFFD4, 0xFFD2, 0xFFD1, 0xFFD0, 0xFFCE, 0xFFCD, 0xFFCC, 0xFFCB, 
+	0xFFCA, 0xFFC9, 0xFFC8, 0xFFC7, 0xFFC6, 0xFFC5, 0xFFC5, 0xFFC4, 0xFFC4, 
+	0xFFC3, 0xFFC3, 0xFFC3, 0xFFC3, 0xFFC3, 0xFFC3, 0xFFC4, 0xFFC5, 0xFFC7, 
+	0xFFC9, 0xFFCC, 0xFFCF, 0xFFD2, 0xFFD6, 0xFFD9, 0xFFDD, 0xFFE1, 0xFFE5, 
+	0xFFE8, 0xFFEC, 0xFFEF, 0xFFF3, 0xFFF6, 0xFFF8, 0xFFFB, 0xFFFC, 0xFFFE, 
+	0xFFFF, 0xF5BB, 0xF5BC, 0xF5BE, 0xF5C2, 0xF5C8, 0xF5CE, 0xF5D7, 0xF5E0, 
+	0xF5EB, 0xF5F7, 0xF604, 0xF613, 0xF622, 0xF632, 0xF644, 0xF656, 0xF669, 
+	0xF67D, 0xF691, 0xF6A6, 0xF6BC, 0xF6D3, 0xF6E9, 0xF701, 0xF718, 0xF730, 
+	0xF749, 0xF761, 0xF77A, 0xF792, 0xF7AB, 0xF7C4, 0xF7DD, 0xF7F5, 0xF80E, 
+	0xF826, 0xF83E, 0xF856, 0xF86D, 0xF884, 0xF89A, 0xF8B0, 0xF8C5, 0xF8DA, 
+	0xF8ED, 0xF900, 0xF913, 0xF924, 0xF934, 0xF944, 0xF952, 0xF95F, 0xF96B, 
+	0xF976, 0xF980, 0xF988, 0xF98F, 0xF994, 0xF998, 0xF99B, 0xF99C, 0xF997, 
+	0xF988, 0xF971, 0xF952, 0xF92C, 0xF900, 0xF8CF, 0xF89A, 0xF861, 0xF826, 
+	0xF7E9, 0xF7AB, 0xF76D, 0xF730, 0xF6F5, 0xF6BC, 0xF687, 0xF656, 0xF62A, 
+	0xF604, 0xF5E6, 0xF5CE, 0xF5C0, 0xDE6C, 0xDE6C, 0xDE6B, 0xDE6B, 0xDE6B, 
+	0xDE6A, 0xDE69, 0xDE68, 0xDE67, 0xDE66, 0xDE65, 0xDE64, 0xDE63, 0xDE61, 
+	0xDE60, 0xDE5E, 0xDE5D, 0xDE5B, 0xDE5A, 0xDE58, 0xDE56, 0xDE55, 0xDE53, 
+	0xDE51, 0xDE50, 0xDE4E, 0xDE4D, 0xDE4B, 0xDE4A, 0xDE48, 0xDE47, 0xDE45, 
+	0xDE44, 0xDE43, 0xDE42, 0xDE41, 0xDE40, 0xDE3F, 0xDE3F, 0xDE3E, 0xDE3E, 
+	0xDE3E, 0xDE3E, 0xDE3E, 0xDE3E, 0xDE3E, 0xDE3F, 0xDE3F, 0xDE40, 0xDE41, 
+	0xDE42, 0xDE43, 0xDE44, 0xDE45, 0xDE47, 0xDE48, 0xDE4A, 0xDE4B, 0xDE4D, 
+	0xDE4E, 0xDE50, 0xDE51, 0xDE53, 0xDE55, 0xDE56, 0xDE58, 0xDE5A, 0xDE5B, 
+	0xDE5D, 0xDE5E, 0xDE60, 0xDE61, 0xDE63, 0xDE64, 0xDE65, 0xDE66, 0xDE67, 
+	0xDE68, 0xDE69, 0xDE6A, 0xDE6B, 0xDE6B, 0xDE6B, 0xDE6C, 0xFA75, 0xFA75, 
+	0xFA77, 0xFA7B, 0xFA80, 0xFA85, 0xFA8D, 0xFA95, 0xFA9E, 0xFAA8, 0xFAB3, 
+	0xFABE, 0xFACB, 0xFAD7, 0xFAE5, 0xFAF3, 0xFB01, 0xFB10, 0xFB1F, 0xFB2F, 
+	0xFB3E, 0xFB4D, 0xFB5D, 0xFB6C, 0xFB7C, 0xFB8B, 0xFB99, 0xFBA8, 0xFBB6, 
+	0xFBC3, 0xFBD0, 0xFBDD, 0xFBE8, 0xFBF3, 0xFBFD, 0xFC06, 0xFC0E, 0xFC15, 
+	0xFC1B, 0xFC20, 0xFC23, 0xFC26, 0xFC26, 0xFC26, 0xFC23, 0xFC20, 0xFC1B, 
+	0xFC15, 0xFC0E, 0xFC06, 0xFBFD, 0xFBF3, 0xFBE8, 0xFBDD, 0xFBD0, 0xFBC3, 
+	0xFBB6, 0xFBA8, 0xFB99, 0xFB8B, 0xFB7C, 0xFB6C, 0xFB5D, 0xFB4D, 0xFB3E, 
+	0xFB2F, 0xFB1F, 0xFB10, 0xFB01, 0xFAF3, 0xFAE5, 0xFAD7, 0xFACB, 0xFABE, 
+	0xFAB3, 0xFAA8, 0xFA9E, 0xFA95, 0xFA8D, 0xFA85, 0xFA80, 0xFA7B, 0xFA77, 
+	0xFA75, 0xF33D, 0xF33D, 0xF33F, 0xF343, 0xF347, 0xF34D, 0xF353, 0xF35B, 
+	0xF363, 0xF36C, 0xF376, 0xF381, 0xF38D, 0xF399, 0xF3A5, 0xF3B2, 0xF3BF, 
+	0xF3CD, 0xF3DB, 0xF3E9, 0xF3F8, 0xF406, 0xF414, 0xF423, 0xF431, 0xF43F, 
+	0xF44C, 0xF45A, 0xF467, 0xF473, 0xF47F, 0xF48B, 0xF496, 0xF4A0, 0xF4A9, 
+	0xF4B1, 0xF4B9, 0xF4BF, 0xF4C5, 0xF4C9, 0xF4CC, 0xF4CE, 0xF4CF, 0xF4CE, 
+	0xF4CC, 0xF4C9, 0xF4C5, 0xF4BF, 0xF4B9, 0xF4B1, 0xF4A9, 0xF4A0, 0xF496, 
+	0xF48B, 0xF47F, 0xF473, 0xF467, 0xF45A, 0xF44C, 0xF43F, 0xF431, 0xF423, 
+	0xF414, 0xF406, 0xF3F8, 0xF3E9, 0xF3DB, 0xF3CD, 0xF3BF, 0xF3B2, 0xF3A5, 
+	0xF399, 0xF38D, 0xF381, 0xF376, 0xF36C, 0xF363, 0xF35B, 0xF353, 0xF34D, 
+	0xF347, 0xF343, 0xF33F, 0xF33D, 0x0000, 0xFFFF, 0xBFFF, 0xEBA7, 0xEBAD, 
+	0xEBBC, 0xEBD5, 0xEBF8, 0xEC23, 0xEC56, 0xEC91, 0xECD3, 0xED1B, 0xED6A, 
+	0xEDBF, 0xEE18, 0xEE76, 0xEED8, 0xEF3E, 0xEFA7, 0xF012, 0xF080, 0xF0EE, 
+	0xF15E, 0xF1CF, 0xF23F, 0xF2AF, 0xF31E, 0xF38C, 0xF3F7, 0xF460, 0xF4C5, 
+	0xF528, 0xF586, 0xF5DF, 0xF633, 0xF682, 0xF6CB, 0xF70D, 0xF748, 0xF77B, 
+	0xF7A6, 0xF7C8, 0xF7E1, 0xF7F1, 0xF7F6, 0xF7F1, 0xF7E1, 0xF7C8, 0xF7A6, 
+	0xF77B, 0xF748, 0xF70D, 0xF6CB, 0xF682, 0xF633, 0xF5DF, 0xF586, 0xF528, 
+	0xF4C5, 0xF460, 0xF3F7, 0xF38C, 0xF31E, 0xF2AF, 0xF23F, 0xF1CF, 0xF15E, 
+	0xF0EE, 0xF080, 0xF012, 0xEFA7, 0xEF3E, 0xEED8, 0xEE76, 0xEE18, 0xEDBF, 
+	0xED6A, 0xED1B, 0xECD3, 0xEC91, 0xEC56, 0xEC23, 0xEBF8, 0xEBD5, 0xEBBC, 
+	0xEBAD, 0x1A7E, 0x1A7F, 0x1A83, 0x1A89, 0x1A91, 0x1A9B, 0x1AA7, 0x1AB5, 
+	0x1AC5, 0x1AD7, 0x1AE9, 0x1AFE, 0x1B13, 0x1B2A, 0x1B41, 0x1B59, 0x1B72, 
+	0x1B8C, 0x1BA6, 0x1BC1, 0x1BDC, 0x1BF6, 0x1C11, 0x1C2C, 0x1C47, 0x1C61, 
+	0x1C7A, 0x1C93, 0x1CAC, 0x1CC3, 0x1CDA, 0x1CEF, 0x1D03, 0x1D16, 0x1D28, 
+	0x1D37, 0x1D45, 0x1D52, 0x1D5C, 0x1D64, 0x1D6A, 0x1D6E, 0x1D6F, 0x1D6E, 
+	0x1D6A, 0x1D64, 0x1D5C, 0x1D52, 0x1D45, 0x1D37, 0x1D28, 0x1D16, 0x1D03, 
+	0x1CEF, 0x1CDA, 0x1CC3, 0x1CAC, 0x1C93, 0x1C7A, 0x1C61, 0x1C47, 0x1C2C, 
+	0x1C11, 0x1BF6, 0x1BDC, 0x1BC1, 0x1BA6, 0x1B8C, 0x1B72, 0x1B59, 0x1B41, 
+	0x1B2A, 0x1B13, 0x1AFE, 0x1AE9, 0x1AD7, 0x1AC5, 0x1AB5, 0x1AA7, 0x1A9B, 
+	0x1A91, 0x1A89, 0x1A83, 0x1A7F, 0xA99A, 0xA99A, 0xA99A, 0xA99A, 0xA99A, 
+	0xA99A, 0xA99A, 0xA999, 0xA999, 0xA999, 0xA998, 0xA998, 0xA997, 0xA997, 
+	0xA996, 0xA996, 0xA995, 0xA995, 0xA994, 0xA994, 0xA993, 0xA993, 0xA992, 
+	0xA992, 0xA991, 0xA991, 0xA990, 0xA990, 0xA98F, 0xA98F, 0xA98E, 0xA98E, 
+	0xA98D, 0xA98D, 0xA98C, 0xA98C, 0xA98C, 0xA98C, 0xA98B, 0xA98B, 0xA98B, 
+	0xA98B, 0xA98B, 0xA98B, 0xA98B, 0xA98B, 0xA98B, 0xA98C, 0xA98C, 0xA98C, 
+	0xA98C, 0xA98D, 0xA98D, 0xA98E, 0xA98E, 0xA98F, 0xA98F, 0xA990, 0xA990, 
+	0xA991, 0xA991, 0xA992, 0xA992, 0xA993, 0xA993, 0xA994, 0xA994, 0xA995, 
+	0xA995, 0xA996, 0xA996, 0xA997, 0xA997, 0xA998, 0xA998, 0xA999, 0xA999, 
+	0xA999, 0xA99A, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xD584, 0x20F5, 0x0D6D, 
+	0xDAD7, 0xFFFF, 0x0000, 0xBF5E, 0xE6B9, 0xE6B9, 0xE6B8, 0xE6B7, 0xE6B6, 
+	0xE6B4, 0xE6B2, 0xE6B0, 0xE6AE, 0xE6AB, 0xE6A8, 0xE6A5, 0xE6A2, 0xE69E, 
+	0xE69A, 0xE697, 0xE693, 0xE68F, 0xE68B, 0xE687, 0xE683, 0xE67E, 0xE67A, 
+	0xE676, 0xE672, 0xE66E, 0xE66A, 0xE666, 0xE662, 0xE65F, 0xE65B, 0xE658, 
+	0xE655, 0xE652, 0xE64F, 0xE64D, 0xE64A, 0xE649, 0xE647, 0xE646, 0xE645, 
+	0xE644, 0xE644, 0xE644, 0xE645, 0xE646, 0xE647, 0xE649, 0xE64A, 0xE64D, 
+	0xE64F, 0xE652, 0xE655, 0xE658, 0xE65B, 0xE65F, 0xE662, 0xE666, 0xE66A, 
+	0xE66E, 0xE672, 0xE676, 0xE67A, 0xE67E, 0xE683, 0xE687, 0xE68B, 0xE68F, 
+	0xE693, 0xE697, 0xE69A, 0xE69E, 0xE6A2, 0xE6A5, 0xE6A8, 0xE6AB, 0xE6AE, 
+	0xE6B0, 0xE6B2, 0xE6B4, 0xE6B6, 0xE6B7, 0xE6B8, 0xE6B9, 0xED8D, 0xED8A, 
+	0xED83, 0xED78, 0xED68, 0xED55, 0xED3E, 0xED23, 0xED05, 0xECE4, 0xECC0, 
+	0xEC9A, 0xEC71, 0xEC46, 0xEC1A, 0xEBEC, 0xEBBC, 0xEB8B, 0xEB5A, 0xEB27, 
+	0xEAF4, 0xEAC1, 0xEA8E, 0xEA5B, 0xEA29, 0xE9F7, 0xE9C7, 0xE997, 0xE969, 
+	0xE93C, 0xE911, 0xE8E9, 0xE8C3, 0xE89F, 0xE87E, 0xE860, 0xE845, 0xE82E, 
+	0xE81A, 0xE80B, 0xE7FF, 0xE7F8, 0xE7F6, 0xE7F8, 0xE7FF, 0xE80B, 0xE81A, 
+	0xE82E, 0xE845, 0xE860, 0xE87E, 0xE89F, 0xE8C3, 0xE8E9, 0xE911, 0xE93C, 
+	0xE969, 0xE997, 0xE9C7, 0xE9F7, 0xEA29, 0xEA5B, 0xEA8E, 0xEAC1, 0xEAF4, 
+	0xEB27, 0xEB5A, 0xEB8B, 0xEBBC, 0xEBEC, 0xEC1A, 0xEC46, 0xEC71, 0xEC9A, 
+	0xECC0, 0xECE4, 0xED05, 0xED23, 0xED3D, 0xED55, 0xED68, 0xED78, 0xED83, 
+	0xED8A, 0xC09C, 0xC09A, 0xC095, 0xC08C, 0xC081, 0xC072, 0xC061, 0xC04D, 
+	0xC036, 0xC01D, 0xC003, 0xBFE6, 0xBFC7, 0xBFA7, 0xBF86, 0xBF63, 0xBF40, 
+	0xBF1B, 0xBEF6, 0xBED0, 0xBEAA, 0xBE84, 0xBE5E, 0xBE38, 0xBE12, 0xBDED, 
+	0xBDC8, 0xBDA5, 0xBD82, 0xBD61, 0xBD41, 0xBD22, 0xBD06, 0xBCEB, 0xBCD2, 
+	0xBCBC, 0xBCA8, 0xBC96, 0xBC88, 0xBC7C, 0xBC73, 0xBC6E, 0xBC6C, 0xBC6E, 
+	0xBC73, 0xBC7C, 0xBC88, 0xBC96, 0xBCA8, 0xBCBC, 0xBCD2, 0xBCEB, 0xBD06, 
+	0xBD22, 0xBD41, 0xBD61, 0xBD82, 0xBDA5, 0xBDC8, 0xBDED, 0xBE12, 0xBE38, 
+	0xBE5E, 0xBE84, 0xBEAA, 0xBED0, 0xBEF6, 0xBF1B, 0xBF40, 0xBF63, 0xBF86, 
+	0xBFA7, 0xBFC7, 0xBFE6, 0xC003, 0xC01D, 0xC036, 0xC04D, 0xC061, 0xC072, 
+	0xC081, 0xC08C, 0xC095, 0xC09A, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 
+	0x0002, 0x0006, 0x000D, 0x0017, 0x0024, 0x0033, 0x0044, 0x0057, 0x006D, 
+	0x0084, 0x009C, 0x00B6, 0x00D2, 0x00EE, 0x010C, 0x012B, 0x014A, 0x016A, 
+	0x018A, 0x01AB, 0x01CC, 0x01ED, 0x020D, 0x022E, 0x024E, 0x026D, 0x028C, 
+	0x02A9, 0x02C6, 0x02E1, 0x02FC, 0x0314, 0x032B, 0x0340, 0x0354, 0x0365, 
+	0x0374, 0x0380, 0x038A, 0x0392, 0x0396, 0x0398, 0x0396, 0x0392, 0x038A, 
+	0x0380, 0x0374, 0x0365, 0x0354, 0x0340, 0x032B, 0x0314, 0x02FC, 0x02E1, 
+	0x02C6, 0x02A9, 0x028C, 0x026D, 0x024E, 0x022E, 0x020D, 0x01ED, 0x01CC, 
+	0x01AB, 0x018A, 0x016A, 0x014A, 0x012B, 0x010C, 0x00EE, 0x00D2, 0x00B6, 
+	0x009C, 0x0084, 0x006D, 0x0057, 0x0044, 0x0033, 0x0024, 0x0017, 0x000D, 
+	0x0006, 0x0002, 0xEE35, 0xEE34, 0xEE34, 0xEE34, 0xEE33, 0xEE33, 0xEE32, 
+	0xEE31, 0xEE30, 0xEE2F, 0xEE2E, 0xEE2D, 0xEE2C, 0xEE2A, 0xEE29, 0xEE27, 
+	0xEE26, 0xEE24, 0xEE23, 0xEE21, 0xEE1F, 0xEE1E, 0xEE1C, 0xEE1A, 0xEE19, 
+	0xEE17, 0xEE16, 0xEE14, 0xEE13, 0xEE11, 0xEE10, 0xEE0F, 0xEE0D, 0xEE0C, 
+	0xEE0B, 0xEE0A, 0xEE09, 0xEE09, 0xEE08, 0xEE08, 0xEE07, 0xEE07, 0xEE07, 
+	0xEE07, 0xEE07, 0xEE08, 0xEE08, 0xEE09, 0xEE09, 0xEE0A, 0xEE0B, 0xEE0C, 
+	0xEE0D, 0xEE0F, 0xEE10, 0xEE11, 0xEE13, 0xEE14, 0xEE16, 0xEE17, 0xEE19, 
+	0xEE1A, 0xEE1C, 0xEE1E, 0xEE1F, 0xEE21, 0xEE23, 0xEE24, 0xEE26, 0xEE27, 
+	0xEE29, 0xEE2A, 0xEE2C, 0xEE2D, 0xEE2E, 0xEE2F, 0xEE30, 0xEE31, 0xEE32, 
+	0xEE33, 0xEE33, 0xEE34, 0xFB94, 0xFB94, 0xFB97, 0xFB9C, 0xFBA2, 0xFBA9, 
+	0xFBB2, 0xFBBD, 0xFBC9, 0xFBD5, 0xFBE3, 0xFBF2, 0xFC02, 0xFC13, 0xFC24, 
+	0xFC36, 0xFC49, 0xFC5C, 0xFC6F, 0xFC83, 0xFC97, 0xFCAB, 0xFCBF, 0xFCD3, 
+	0xFCE6, 0xFCFA, 0xFD0D, 0xFD1F, 0xFD31, 0xFD43, 0xFD53, 0xFD63, 0xFD72, 
+	0xFD80, 0xFD8D, 0xFD99, 0xFDA3, 0xFDAC, 0xFDB4, 0xFDBA, 0xFDBE, 0xFDC1, 
+	0xFDC2, 0xFDC1, 0xFDBE, 0xFDBA, 0xFDB4, 0xFDAC, 0xFDA3, 0xFD99, 0xFD8D, 
+	0xFD80, 0xFD72, 0xFD63, 0xFD53, 0xFD43, 0xFD31, 0xFD1F, 0xFD0D, 0xFCFA, 
+	0xFCE6, 0xFCD3, 0xFCBF, 0xFCAB, 0xFC97, 0xFC83, 0xFC6F, 0xFC5C, 0xFC49, 
+	0xFC36, 0xFC24, 0xFC13, 0xFC02, 0xFBF2, 0xFBE3, 0xFBD5, 0xFBC9, 0xFBBD, 
+	0xFBB2, 0xFBA9, 0xFBA2, 0xFB9C, 0xFB97, 0xFB94, 0xDC44, 0xDC46, 0xDC4A, 
+	0xDC51, 0xDC5A, 0xDC66, 0xDC74, 0xDC84, 0xDC96, 0xDCAA, 0xDCC0, 0xDCD7, 
+	0xDCEF, 0xDD09, 0xDD24, 0xDD40, 0xDD5C, 0xDD7A, 0xDD98, 0xDDB6, 0xDDD5, 
+	0xDDF3, 0xDE12, 0xDE31, 0xDE4F, 0xDE6D, 0xDE8A, 0xDEA7, 0xDEC3, 0xDEDE, 
+	0xDEF7, 0xDF10, 0xDF27, 0xDF3D, 0xDF50, 0xDF62, 0xDF73, 0xDF81, 0xDF8C, 
+	0xDF96, 0xDF9D, 0xDFA1, 0xDFA2, 0xDFA1, 0xDF9D, 0xDF96, 0xDF8C, 0xDF81, 
+	0xDF73, 0xDF62, 0xDF50, 0xDF3D, 0xDF27, 0xDF10, 0xDEF7, 0xDEDE, 0xDEC3, 
+	0xDEA7, 0xDE8A, 0xDE6D, 0xDE4F, 0xDE31, 0xDE12, 0xDDF3, 0xDDD5, 0xDDB6, 
+	0xDD98, 0xDD7A, 0xDD5C, 0xDD40, 0xDD24, 0xDD09, 0xDCEF, 0xDCD7, 0xDCC0, 
+	0xDCAA, 0xDC96, 0xDC84, 0xDC74, 0xDC66, 0xDC5A, 0xDC51, 0xDC4A, 0xDC46, 
+	0xFFFF, 0x0000, 0xBF5E, 0x08EE, 0x08EE, 0x08EF, 0x08F0, 0x08F1, 0x08F2, 
+	0x08F4, 0x08F5, 0x08F7, 0x08FA, 0x08FC, 0x08FF, 0x0901, 0x0904, 0x0907, 
+	0x090A, 0x090D, 0x0911, 0x0914, 0x0917, 0x091B, 0x091E, 0x0922, 0x0925, 
+	0x0928, 0x092C, 0x092F, 0x0932, 0x0935, 0x0938, 0x093B, 0x093E, 0x0940, 
+	0x0943, 0x0945, 0x0947, 0x0949, 0x094A, 0x094C, 0x094D, 0x094D, 0x094E, 
+	0x094E, 0x094E, 0x094D, 0x094D, 0x094C, 0x094A, 0x0949, 0x0947, 0x0945, 
+	0x0943, 0x0940, 0x093E, 0x093B, 0x0938, 0x0935, 0x0932, 0x092F, 0x092C, 
+	0x0928, 0x0925, 0x0922, 0x091E, 0x091B, 0x0917, 0x0914, 0x0911, 0x090D, 
+	0x090A, 0x0907, 0x0904, 0x0901, 0x08FF, 0x08FC, 0x08FA, 0x08F7, 0x08F5, 
+	0x08F4, 0x08F2, 0x08F1, 0x08F0, 0x08EF, 0x08EE, 0x049F, 0x049D, 0x0498, 
+	0x0490, 0x0485, 0x0477, 0x0467, 0x0454, 0x043E, 0x0427, 0x040D, 0x03F2, 
+	0x03D5, 0x03B7, 0x0397, 0x0376, 0x0354, 0x0332, 0x030E, 0x02EA, 0x02C6, 
+	0x02A2, 0x027E, 0x0259, 0x0236, 0x0212, 0x01EF, 0x01CE, 0x01AD, 0x018D, 
+	0x016F, 0x0152, 0x0136, 0x011D, 0x0106, 0x00F0, 0x00DD, 0x00CD, 0x00BF, 
+	0x00B4, 0x00AB, 0x00A6, 0x00A5, 0x00A6, 0x00AB, 0x00B4, 0x00BF, 0x00CD, 
+	0x00DD, 0x00F0, 0x0106, 0x011D, 0x0136, 0x0152, 0x016F, 0x018D, 0x01AD, 
+	0x01CE, 0x01EF, 0x0212, 0x0236, 0x0259, 0x027E, 0x02A2, 0x02C6, 0x02EA, 
+	0x030E, 0x0332, 0x0354, 0x0376, 0x0397, 0x03B7, 0x03D5, 0x03F2, 0x040D, 
+	0x0427, 0x043E, 0x0454, 0x0467, 0x0477, 0x0485, 0x0490, 0x0498, 0x049D, 
+	0xACD4, 0xACD2, 0xACCB, 0xACC0, 0xACB0, 0xAC9D, 0xAC86, 0xAC6C, 0xAC4F, 
+	0xAC2E, 0xAC0B, 0xABE6, 0xABBE, 0xAB94, 0xAB68, 0xAB3B, 0xAB0C, 0xAADC, 
+	0xAAAB, 0xAA7A, 0xAA48, 0xAA16, 0xA9E3, 0xA9B2, 0xA980, 0xA94F, 0xA91F, 
+	0xA8F1, 0xA8C3, 0xA898, 0xA86E, 0xA846, 0xA820, 0xA7FD, 0xA7DD, 0xA7BF, 
+	0xA7A5, 0xA78E, 0xA77B, 0xA76C, 0xA760, 0xA759, 0xA757, 0xA759, 0xA760, 
+	0xA76C, 0xA77B, 0xA78E, 0xA7A5, 0xA7BF, 0xA7DD, 0xA7FD, 0xA820, 0xA846, 
+	0xA86E, 0xA898, 0xA8C3, 0xA8F1, 0xA91F, 0xA94F, 0xA980, 0xA9B2, 0xA9E3, 
+	0xAA16, 0xAA48, 0xAA7A, 0xAAAB, 0xAADC, 0xAB0C, 0xAB3B, 0xAB68, 0xAB94, 
+	0xABBE, 0xABE6, 0xAC0B, 0xAC2E, 0xAC4F, 0xAC6C, 0xAC86, 0xAC9D, 0xACB0, 
+	0xACC0, 0xACCB, 0xACD2, 0x0000, 0x0000, 0x0002, 0x0003, 0x0006, 0x0009, 
+	0x000D, 0x0012, 0x0017, 0x001C, 0x0022, 0x0029, 0x002F, 0x0036, 0x003E, 
+	0x0046, 0x004E, 0x0056, 0x005E, 0x0066, 0x006F, 0x0077, 0x0080, 0x0088, 
+	0x0091, 0x0099, 0x00A1, 0x00A9, 0x00B1, 0x00B8, 0x00BF, 0x00C6, 0x00CD, 
+	0x00D3, 0x00D8, 0x00DD, 0x00E1, 0x00E5, 0x00E9, 0x00EB, 0x00ED, 0x00EE, 
+	0x00EF, 0x00EE, 0x00ED, 0x00EB, 0x00E9, 0x00E5, 0x00E1, 0x00DD, 0x00D8, 
+	0x00D3, 0x00CD, 0x00C6, 0x00BF, 0x00B8, 0x00B1, 0x00A9, 0x00A1, 0x0099, 
+	0x0091, 0x0088, 0x0080, 0x0077, 0x006F, 0x0066, 0x005E, 0x0056, 0x004E, 
+	0x0046, 0x003E, 0x0036, 0x002F, 0x0029, 0x0022, 0x001C, 0x0017, 0x0012, 
+	0x000D, 0x0009, 0x0006, 0x0003, 0x0002, 0x0000, 0xFFFF, 0x0001, 0x0003, 
+	0x0007, 0x000C, 0x0012, 0x001A, 0x0023, 0x002D, 0x0038, 0x0043, 0x0050, 
+	0x005E, 0x006C, 0x007A, 0x008A, 0x0099, 0x00A9, 0x00BA, 0x00CA, 0x00DB, 
+	0x00EC, 0x00FD, 0x010D, 0x011E, 0x012E, 0x013F, 0x014E, 0x015D, 0x016C, 
+	0x017A, 0x0188, 0x0194, 0x01A0, 0x01AB, 0x01B5, 0x01BE, 0x01C5, 0x01CC, 
+	0x01D1, 0x01D5, 0x01D7, 0x01D8, 0x01D7, 0x01D5, 0x01D1, 0x01CC, 0x01C5, 
+	0x01BE, 0x01B5, 0x01AB, 0x01A0, 0x0194, 0x0188, 0x017A, 0x016C, 0x015D, 
+	0x014E, 0x013F, 0x012E, 0x011E, 0x010D, 0x00FD, 0x00EC, 0x00DB, 0x00CA, 
+	0x00BA, 0x00A9, 0x0099, 0x008A, 0x007A, 0x006C, 0x005E, 0x0050, 0x0043, 
+	0x0038, 0x002D, 0x0023, 0x001A, 0x0012, 0x000C, 0x0007, 0x0003, 0x0001, 
+	0x25EE, 0x25F1, 0x25FB, 0x260C, 0x2623, 0x263F, 0x2661, 0x2687, 0x26B3, 
+	0x26E3, 0x2716, 0x274E, 0x2789, 0x27C7, 0x2807, 0x284A, 0x288F, 0x28D6, 
+	0x291E, 0x2967, 0x29B1, 0x29FB, 0x2A45, 0x2A8E, 0x2AD7, 0x2B1F, 0x2B66, 
+	0x2BAB, 0x2BEE, 0x2C2E, 0x2C6C, 0x2CA7, 0x2CDF, 0x2D12, 0x2D42, 0x2D6E, 
+	0x2D94, 0x2DB6, 0x2DD2, 0x2DE9, 0x2DFA, 0x2E04, 0x2E07, 0x2E04, 0x2DFA, 
+	0x2DE9, 0x2DD2, 0x2DB6, 0x2D94, 0x2D6E, 0x2D42, 0x2D12, 0x2CDF, 0x2CA7, 
+	0x2C6C, 0x2C2E, 0x2BEE, 0x2BAB, 0x2B66, 0x2B1F, 0x2AD7, 0x2A8E, 0x2A45, 
+	0x29FB, 0x29B1, 0x2967, 0x291E, 0x28D6, 0x288F, 0x284A, 0x2807, 0x27C7, 
+	0x2789, 0x274E, 0x2716, 0x26E3, 0x26B3, 0x2687, 0x2661, 0x263F, 0x2623, 
+	0x260C, 0x25FB, 0x25F1, 0x0047, 0x0046, 0x0043, 0x003D, 0x0036, 0x002D, 
+	0x0022, 0x0016, 0x0008, 0xFFF8, 0xFFE7, 0xFFD6, 0xFFC3, 0xFFAF, 0xFF9B, 
+	0xFF85, 0xFF6F, 0xFF59, 0xFF42, 0xFF2B, 0xFF13, 0xFEFC, 0xFEE4, 0xFECD, 
+	0xFEB5, 0xFE9E, 0xFE88, 0xFE72, 0xFE5D, 0xFE48, 0xFE34, 0xFE22, 0xFE10, 
+	0xFDFF, 0xFDF0, 0xFDE2, 0xFDD6, 0xFDCB, 0xFDC2, 0xFDBB, 0xFDB6, 0xFDB3, 
+	0xFDB1, 0xFDB3, 0xFDB6, 0xFDBB, 0xFDC2, 0xFDCB, 0xFDD6, 0xFDE2, 0xFDF0, 
+	0xFDFF, 0xFE10, 0xFE22, 0xFE34, 0xFE48, 0xFE5D, 0xFE72, 0xFE88, 0xFE9E, 
+	0xFEB5, 0xFECD, 0xFEE4, 0xFEFC, 0xFF13, 0xFF2B, 0xFF42, 0xFF59, 0xFF6F, 
+	0xFF85, 0xFF9B, 0xFFAF, 0xFFC3, 0xFFD6, 0xFFE7, 0xFFF8, 0x0008, 0x0016, 
+	0x0022, 0x002D, 0x0036, 0x003D, 0x0043, 0x0046, 0xFF3B, 0xFF3C, 0xFF3D, 
+	0xFF40, 0xFF43, 0xFF47, 0xFF4C, 0xFF51, 0xFF58, 0xFF5E, 0xFF66, 0xFF6E, 
+	0xFF76, 0xFF7F, 0xFF88, 0xFF92, 0xFF9B, 0xFFA5, 0xFFB0, 0xFFBA, 0xFFC5, 
+	0xFFCF, 0xFFDA, 0xFFE4, 0xFFEF, 0xFFF9, 0x0004, 0x000E, 0x0017, 0x0020, 
+	0x0029, 0x0032, 0x003A, 0x0041, 0x0048, 0x004E, 0x0053, 0x0058, 0x005C, 
+	0x005F, 0x0062, 0x0063, 0x0064, 0x0063, 0x0062, 0x005F, 0x005C, 0x0058, 
+	0x0053, 0x004E, 0x0048, 0x0041, 0x003A, 0x0032, 0x0029, 0x0020, 0x0017, 
+	0x000E, 0x0004, 0xFFF9, 0xFFEF, 0xFFE4, 0xFFDA, 0xFFCF, 0xFFC5, 0xFFBA, 
+	0xFFB0, 0xFFA5, 0xFF9B, 0xFF92, 0xFF88, 0xFF7F, 0xFF76, 0xFF6E, 0xFF66, 
+	0xFF5E, 0xFF58, 0xFF51, 0xFF4C, 0xFF47, 0xFF43, 0xFF40, 0xFF3D, 0xFF3C, 
+	0xBBA8, 0xBBA7, 0xBBA2, 0xBB9A, 0xBB90, 0xBB82, 0xBB72, 0xBB60, 0xBB4C, 
+	0xBB35, 0xBB1D, 0xBB02, 0xBAE7, 0xBAC9, 0xBAAB, 0xBA8B, 0xBA6B, 0xBA49, 
+	0xBA27, 0xBA05, 0xB9E2, 0xB9BF, 0xB99C, 0xB97A, 0xB957, 0xB935, 0xB914, 
+	0xB8F3, 0xB8D4, 0xB8B5, 0xB898, 0xB87C, 0xB862, 0xB84A, 0xB833, 0xB81F, 
+	0xB80C, 0xB7FD, 0xB7EF, 0xB7E4, 0xB7DD, 0xB7D8, 0xB7D6, 0xB7D8, 0xB7DD, 
+	0xB7E4, 0xB7EF, 0xB7FD, 0xB80C, 0xB81F, 0xB833, 0xB84A, 0xB862, 0xB87C, 
+	0xB898, 0xB8B5, 0xB8D4, 0xB8F3, 0xB914, 0xB935, 0xB957, 0xB97A, 0xB99C, 
+	0xB9BF, 0xB9E2, 0xBA05, 0xBA27, 0xBA49, 0xBA6B, 0xBA8B, 0xBAAB, 0xBAC9, 
+	0xBAE7, 0xBB02, 0xBB1D, 0xBB35, 0xBB4C, 0xBB60, 0xBB72, 0xBB82, 0xBB90, 
+	0xBB9A, 0xBBA2, 0xBBA7, 
+	},{ 
+	0x004D, 0x0000, 0x0053, 0x004D, 0x0051, 0x00A0, 0x0001, 0x00F1, 0x0001, 
+	0x00F2, 0x0001, 0x00F3, 0x0001, 0x00F4, 0x0001, 0x00F5, 0x0001, 0x00F6, 
+	0x0052, 0x00F7, 0x0054, 0x0149, 0x0054, 0x019D, 0x0054, 0x01F1, 0x0054, 
+	0x0245, 0x0054, 0x0299, 0x0001, 0x02ED, 0x0001, 0x02EE, 0x0001, 0x02EF, 
+	0x0054, 0x02F0, 0x0053, 0x0344, 0x0054, 0x0397, 0x0054, 0x03EB, 0x0054, 
+	0x043F, 0x0054, 0x0493, 0x0054, 0x04E7, 0x0054, 0x053B, 0x0054, 0x058F, 
+	0x0001, 0x05E3, 0x0001, 0x05E4, 0x0001, 0x05E5, 0x0054, 0x05E6, 0x0054, 
+	0x063A, 0x004F, 0x068E, 0x004F, 0x06DD, 0x004E, 0x072C, 0x0001, 0x077A, 
+	0x0001, 0x077B, 0x0001, 0x077C, 0x0001, 0x077D, 0x0001, 0x077E, 0x0001, 
+	0x077F, 0x0001, 0x0780, 0x0054, 0x0781, 0x0054, 0x07D5, 0x0054, 0x0829, 
+	0x0054, 0x087D, 0x0052, 0x08D1, 0x0054, 0x0923, 0x0052, 0x0977, 0x0054, 
+	0x09C9, 0x0054, 0x0A1D, 0x0001, 0x0A71, 0x0001, 0x0A72, 0x0001, 0x0A73, 
+	0x0054, 0x0A74, 0x0054, 0x0AC8, 0x0054, 0x0B1C, 0x0054, 0x0B70, 0x0054, 
+	0x0BC4, 0x0054, 0x0C18, 0x0054, 0x0C6C, 0x0054, 0x0CC0, 0x0054, 0x0D14, 
+})
+
+LUIGI_ANIM_CS_MENU = "luigi_anim_cs_menu"
+smlua_anim_util_register_animation(LUIGI_ANIM_CS_MENU,
+	0,
+	0,
+	0,
+	0,
+	41,
+	{ 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 
+	0xFFFE, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFC, 0xFFFC, 0xFFFB, 0xFFFB, 0xFFFB, 
+	0xFFFB, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFFB, 0xFFFB, 0xFFFB, 
+	0xFFFB, 0xFFFC, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0093, 0x0093, 0x0093, 0x0093, 0x0092, 
+	0x0092, 0x0091, 0x0091, 0x0090, 0x0090, 0x008F, 0x008E, 0x008E, 0x008D, 
+	0x008C, 0x008C, 0x008B, 0x008B, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 
+	0x008A, 0x008A, 0x008B, 0x008B, 0x008C, 0x008C, 0x008D, 0x008E, 0x008E, 
+	0x008F, 0x0090, 0x0090, 0x0091, 0x0091, 0x0092, 0x0092, 0x0093, 0x0000, 
+	0x0000, 0x3FFF, 0x0000, 0xE332, 0x0F58, 0x5092, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0xF904, 0xF8FA, 0xF8DE, 0xF8B2, 0xF877, 0xF830, 0xF7DE, 0xF784, 0xF723, 
+	0xF6BD, 0xF654, 0xF5EA, 0xF581, 0xF51B, 0xF4BA, 0xF460, 0xF40E, 0xF3C7, 
+	0xF38C, 0xF360, 0xF344, 0xF33A, 0xF344, 0xF360, 0xF38C, 0xF3C7, 0xF40E, 
+	0xF460, 0xF4BA, 0xF51B, 0xF581, 0xF5EA, 0xF654, 0xF6BD, 0xF723, 0xF784, 
+	0xF7DE, 0xF830, 0xF877, 0xF8B2, 0xF8DE, 0xF8FA, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0x0000, 0xEEFC, 0xEF0E, 0xEF3F, 0xEF8E, 0xEFF7, 0xF076, 
+	0xF107, 0xF1A8, 0xF255, 0xF30A, 0xF3C5, 0xF481, 0xF53C, 0xF5F1, 0xF69E, 
+	0xF73F, 0xF7D1, 0xF850, 0xF8B8, 0xF907, 0xF939, 0xF94A, 0xF939, 0xF907, 
+	0xF8B8, 0xF850, 0xF7D1, 0xF73F, 0xF69E, 0xF5F1, 0xF53C, 0xF481, 0xF3C5, 
+	0xF30A, 0xF255, 0xF1A8, 0xF107, 0xF076, 0xEFF7, 0xEF8E, 0xEF3F, 0xEF0E, 
+	0x0000, 0xFFFF, 0xBFFF, 0xD4CC, 0xD4D5, 0xD4EE, 0xD514, 0xD548, 0xD586, 
+	0xD5CE, 0xD61D, 0xD672, 0xD6CB, 0xD727, 0xD784, 0xD7E0, 0xD839, 0xD88E, 
+	0xD8DD, 0xD925, 0xD963, 0xD997, 0xD9BD, 0xD9D6, 0xD9DE, 0xD9D6, 0xD9BD, 
+	0xD997, 0xD963, 0xD925, 0xD8DD, 0xD88E, 0xD839, 0xD7E0, 0xD784, 0xD727, 
+	0xD6CB, 0xD672, 0xD61D, 0xD5CE, 0xD586, 0xD548, 0xD514, 0xD4EE, 0xD4D5, 
+	0xD877, 0xD86F, 0xD858, 0xD834, 0xD804, 0xD7C9, 0xD786, 0xD73C, 0xD6ED, 
+	0xD699, 0xD644, 0xD5ED, 0xD597, 0xD544, 0xD4F4, 0xD4AA, 0xD467, 0xD42D, 
+	0xD3FD, 0xD3D9, 0xD3C2, 0xD3BA, 0xD3C2, 0xD3D9, 0xD3FD, 0xD42D, 0xD467, 
+	0xD4AA, 0xD4F4, 0xD544, 0xD597, 0xD5ED, 0xD644, 0xD699, 0xD6ED, 0xD73C, 
+	0xD786, 0xD7C9, 0xD804, 0xD834, 0xD858, 0xD86F, 0xE45A, 0xE450, 0xE433, 
+	0xE406, 0xE3CA, 0xE381, 0xE32E, 0xE2D2, 0xE26E, 0xE206, 0xE19B, 0xE130, 
+	0xE0C5, 0xE05D, 0xDFF9, 0xDF9D, 0xDF4A, 0xDF01, 0xDEC5, 0xDE98, 0xDE7B, 
+	0xDE71, 0xDE7B, 0xDE98, 0xDEC5, 0xDF01, 0xDF4A, 0xDF9D, 0xDFF9, 0xE05D, 
+	0xE0C5, 0xE130, 0xE19B, 0xE206, 0xE26E, 0xE2D2, 0xE32E, 0xE381, 0xE3CA, 
+	0xE406, 0xE433, 0xE450, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFF8, 0xFFE3, 
+	0xFFC1, 0xFF94, 0xFF5B, 0xFF19, 0xFECE, 0xFE7B, 0xFE21, 0xFDC2, 0xFD5D, 
+	0xFCF5, 0xFC89, 0xFC1C, 0xFBAE, 0xFB3F, 0xFAD2, 0xFA66, 0xF9FE, 0xF999, 
+	0xF93A, 0xF8E0, 0xF88D, 0xF842, 0xF800, 0xF7C8, 0xF79A, 0xF778, 0xF763, 
+	0xF75C, 0xF788, 0xF800, 0xF8B6, 0xF999, 0xFA9C, 0xFBAE, 0xFCBF, 0xFDC2, 
+	0xFEA6, 0xFF5B, 0xFFD4, 0xDA3F, 0xDA47, 0xDA5D, 0xDA81, 0xDAB2, 0xDAEE, 
+	0xDB34, 0xDB84, 0xDBDC, 0xDC3B, 0xDCA1, 0xDD0C, 0xDD7B, 0xDDED, 0xDE62, 
+	0xDED7, 0xDF4D, 0xDFC1, 0xE033, 0xE0A2, 0xE10D, 0xE173, 0xE1D3, 0xE22B, 
+	0xE27B, 0xE2C1, 0xE2FD, 0xE32D, 0xE351, 0xE367, 0xE36F, 0xE341, 0xE2C1, 
+	0xE200, 0xE10D, 0xDFFB, 0xDED7, 0xDDB4, 0xDCA1, 0xDBAF, 0xDAEE, 0xDA6E, 
+	0xE991, 0xE999, 0xE9B0, 0xE9D6, 0xEA09, 0xEA48, 0xEA92, 0xEAE6, 0xEB43, 
+	0xEBA8, 0xEC13, 0xEC84, 0xECF9, 0xED71, 0xEDEC, 0xEE68, 0xEEE3, 0xEF5E, 
+	0xEFD6, 0xF04B, 0xF0BC, 0xF127, 0xF18C, 0xF1E9, 0xF23D, 0xF287, 0xF2C6, 
+	0xF2F9, 0xF31F, 0xF336, 0xF33E, 0xF30E, 0xF287, 0xF1BB, 0xF0BC, 0xEF9A, 
+	0xEE68, 0xED35, 0xEC13, 0xEB14, 0xEA48, 0xE9C1, 0xFD43, 0xFD39, 0xFD1D, 
+	0xFCF0, 0xFCB3, 0xFC67, 0xFC0F, 0xFBAA, 0xFB3B, 0xFAC3, 0xFA43, 0xF9BC, 
+	0xF930, 0xF8A0, 0xF80D, 0xF779, 0xF6E5, 0xF652, 0xF5C2, 0xF536, 0xF4B0, 
+	0xF42F, 0xF3B7, 0xF348, 0xF2E3, 0xF28B, 0xF23F, 0xF202, 0xF1D5, 0xF1B9, 
+	0xF1AF, 0xF1E9, 0xF28B, 0xF37E, 0xF4B0, 0xF60A, 0xF779, 0xF8E8, 0xFA43, 
+	0xFB74, 0xFC67, 0xFD09, 0x0000, 0xFFFF, 0xBFFF, 0xF0C9, 0xF0DC, 0xF115, 
+	0xF16D, 0xF1E3, 0xF272, 0xF316, 0xF3CB, 0xF48E, 0xF55A, 0xF62C, 0xF700, 
+	0xF7D3, 0xF89F, 0xF962, 0xFA17, 0xFABB, 0xFB4A, 0xFBBF, 0xFC18, 0xFC50, 
+	0xFC64, 0xFC50, 0xFC18, 0xFBBF, 0xFB4A, 0xFABB, 0xFA17, 0xF962, 0xF89F, 
+	0xF7D3, 0xF700, 0xF62C, 0xF55A, 0xF48E, 0xF3CB, 0xF316, 0xF272, 0xF1E3, 
+	0xF16D, 0xF115, 0xF0DC, 0x1465, 0x1460, 0x1453, 0x143D, 0x1421, 0x13FF, 
+	0x13D7, 0x13AB, 0x137C, 0x134B, 0x1318, 0x12E5, 0x12B2, 0x1281, 0x1252, 
+	0x1226, 0x11FF, 0x11DC, 0x11C0, 0x11AA, 0x119D, 0x1198, 0x119D, 0x11AA, 
+	0x11C0, 0x11DC, 0x11FF, 0x1226, 0x1252, 0x1281, 0x12B2, 0x12E5, 0x1318, 
+	0x134B, 0x137C, 0x13AB, 0x13D7, 0x13FF, 0x1421, 0x143D, 0x1453, 0x1460, 
+	0x5DB3, 0x5DC7, 0x5DFF, 0x5E58, 0x5ECE, 0x5F5C, 0x6000, 0x60B5, 0x6178, 
+	0x6245, 0x6317, 0x63EB, 0x64BD, 0x6589, 0x664C, 0x6701, 0x67A5, 0x6834, 
+	0x68AA, 0x6903, 0x693B, 0x694E, 0x693B, 0x6903, 0x68AA, 0x6834, 0x67A5, 
+	0x6701, 0x664C, 0x6589, 0x64BD, 0x63EB, 0x6317, 0x6245, 0x6178, 0x60B6, 
+	0x6000, 0x5F5C, 0x5ECE, 0x5E58, 0x5DFF, 0x5DC7, 0xFFFF, 0x0000, 0xE171, 
+	0xE16F, 0xE16A, 0xE162, 0xE157, 0xE14A, 0xE13B, 0xE12B, 0xE119, 0xE106, 
+	0xE0F3, 0xE0E0, 0xE0CD, 0xE0BA, 0xE0A9, 0xE098, 0xE089, 0xE07C, 0xE072, 
+	0xE06A, 0xE064, 0xE063, 0xE064, 0xE06A, 0xE072, 0xE07C, 0xE089, 0xE098, 
+	0xE0A9, 0xE0BA, 0xE0CD, 0xE0E0, 0xE0F3, 0xE106, 0xE119, 0xE12B, 0xE13B, 
+	0xE14A, 0xE157, 0xE162, 0xE16A, 0xE16F, 0x0E24, 0x0E24, 0x0E24, 0x0E25, 
+	0x0E26, 0x0E27, 0x0E29, 0x0E2A, 0x0E2C, 0x0E2E, 0x0E30, 0x0E32, 0x0E33, 
+	0x0E35, 0x0E37, 0x0E39, 0x0E3A, 0x0E3B, 0x0E3C, 0x0E3D, 0x0E3E, 0x0E3E, 
+	0x0E3E, 0x0E3D, 0x0E3C, 0x0E3B, 0x0E3A, 0x0E39, 0x0E37, 0x0E35, 0x0E33, 
+	0x0E32, 0x0E30, 0x0E2E, 0x0E2C, 0x0E2A, 0x0E29, 0x0E27, 0x0E26, 0x0E25, 
+	0x0E24, 0x02BF, 0x02BE, 0x02B9, 0x02B2, 0x02A8, 0x029D, 0x028F, 0x0281, 
+	0x0271, 0x0260, 0x024F, 0x023E, 0x022D, 0x021D, 0x020D, 0x01FE, 0x01F1, 
+	0x01E6, 0x01DC, 0x01D5, 0x01D0, 0x01CF, 0x01D0, 0x01D5, 0x01DC, 0x01E6, 
+	0x01F1, 0x01FE, 0x020D, 0x021D, 0x022D, 0x023E, 0x024F, 0x0260, 0x0271, 
+	0x0281, 0x028F, 0x029D, 0x02A8, 0x02B2, 0x02B9, 0x02BE, 0xF6AE, 0xF6A1, 
+	0xF67C, 0xF641, 0xF5F4, 0xF596, 0xF52A, 0xF4B3, 0xF433, 0xF3AC, 0xF322, 
+	0xF297, 0xF20C, 0xF186, 0xF106, 0xF08F, 0xF023, 0xEFC5, 0xEF77, 0xEF3D, 
+	0xEF18, 0xEF0B, 0xEF18, 0xEF3D, 0xEF77, 0xEFC5, 0xF023, 0xF08F, 0xF106, 
+	0xF186, 0xF20C, 0xF297, 0xF322, 0xF3AC, 0xF433, 0xF4B3, 0xF52A, 0xF596, 
+	0xF5F4, 0xF641, 0xF67C, 0xF6A1, 0x0000, 0xFFFF, 0xBF5E, 0xB180, 0xB176, 
+	0xB15B, 0xB131, 0xB0F8, 0xB0B3, 0xB064, 0xB00D, 0xAFAF, 0xAF4D, 0xAEE8, 
+	0xAE82, 0xAE1D, 0xADBB, 0xAD5D, 0xAD06, 0xACB7, 0xAC72, 0xAC39, 0xAC0F, 
+	0xABF4, 0xABEA, 0xABF4, 0xAC0F, 0xAC39, 0xAC72, 0xACB7, 0xAD06, 0xAD5D, 
+	0xADBB, 0xAE1D, 0xAE82, 0xAEE8, 0xAF4D, 0xAFAF, 0xB00D, 0xB064, 0xB0B3, 
+	0xB0F8, 0xB131, 0xB15B, 0xB176, 0xE760, 0xE754, 0xE72F, 0xE6F5, 0xE6A8, 
+	0xE64B, 0xE5E0, 0xE56A, 0xE4EB, 0xE466, 0xE3DD, 0xE352, 0xE2C9, 0xE244, 
+	0xE1C5, 0xE14F, 0xE0E4, 0xE087, 0xE03A, 0xE000, 0xDFDC, 0xDFCF, 0xDFDC, 
+	0xE000, 0xE03A, 0xE087, 0xE0E4, 0xE14F, 0xE1C5, 0xE244, 0xE2C9, 0xE352, 
+	0xE3DD, 0xE466, 0xE4EB, 0xE56A, 0xE5E0, 0xE64B, 0xE6A8, 0xE6F5, 0xE72F, 
+	0xE754, 0xBA08, 0xBA12, 0xBA2F, 0xBA5D, 0xBA99, 0xBAE3, 0xBB38, 0xBB95, 
+	0xBBFA, 0xBC63, 0xBCD0, 0xBD3D, 0xBDAA, 0xBE13, 0xBE78, 0xBED5, 0xBF2A, 
+	0xBF74, 0xBFB1, 0xBFDE, 0xBFFB, 0xC006, 0xBFFB, 0xBFDE, 0xBFB1, 0xBF74, 
+	0xBF2A, 0xBED5, 0xBE78, 0xBE13, 0xBDAA, 0xBD3D, 0xBCD0, 0xBC63, 0xBBFA, 
+	0xBB95, 0xBB38, 0xBAE3, 0xBA99, 0xBA5D, 0xBA2F, 0xBA12, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0018, 0x005C, 0x00C7, 0x0156, 
+	0x0203, 0x02C9, 0x03A4, 0x0490, 0x0588, 0x0686, 0x0787, 0x0885, 0x097C, 
+	0x0A68, 0x0B44, 0x0C0A, 0x0CB7, 0x0D45, 0x0DB1, 0x0DF5, 0x0E0D, 0x0DF5, 
+	0x0DB1, 0x0D45, 0x0CB7, 0x0C0A, 0x0B44, 0x0A68, 0x097C, 0x0885, 0x0787, 
+	0x0686, 0x0588, 0x0490, 0x03A4, 0x02C9, 0x0203, 0x0156, 0x00C7, 0x005C, 
+	0x0018, 0xF9B8, 0xF9B8, 0xF9B8, 0xF9B9, 0xF9BA, 0xF9BB, 0xF9BC, 0xF9BD, 
+	0xF9BF, 0xF9C0, 0xF9C2, 0xF9C3, 0xF9C5, 0xF9C6, 0xF9C8, 0xF9C9, 0xF9CA, 
+	0xF9CB, 0xF9CC, 0xF9CD, 0xF9CD, 0xF9CD, 0xF9CD, 0xF9CD, 0xF9CC, 0xF9CB, 
+	0xF9CA, 0xF9C9, 0xF9C8, 0xF9C6, 0xF9C5, 0xF9C3, 0xF9C2, 0xF9C0, 0xF9BF, 
+	0xF9BD, 0xF9BC, 0xF9BB, 0xF9BA, 0xF9B9, 0xF9B8, 0x01DD, 0x01DA, 0x01D3, 
+	0x01C7, 0x01B8, 0x01A5, 0x0190, 0x0178, 0x015E, 0x0144, 0x0128, 0x010C, 
+	0x00F1, 0x00D6, 0x00BD, 0x00A5, 0x0090, 0x007D, 0x006E, 0x0062, 0x005B, 
+	0x0058, 0x005B, 0x0062, 0x006E, 0x007D, 0x0090, 0x00A5, 0x00BD, 0x00D6, 
+	0x00F1, 0x010C, 0x0128, 0x0144, 0x015E, 0x0178, 0x0190, 0x01A5, 0x01B8, 
+	0x01C7, 0x01D3, 0x01DA, 0xEA21, 0xEA19, 0xEA02, 0xE9DE, 0xE9AF, 0xE976, 
+	0xE934, 0xE8EB, 0xE89C, 0xE84A, 0xE7F6, 0xE7A0, 0xE74C, 0xE6FA, 0xE6AB, 
+	0xE663, 0xE621, 0xE5E7, 0xE5B8, 0xE594, 0xE57E, 0xE576, 0xE57E, 0xE594, 
+	0xE5B8, 0xE5E7, 0xE621, 0xE663, 0xE6AB, 0xE6FA, 0xE74C, 0xE7A0, 0xE7F6, 
+	0xE84A, 0xE89C, 0xE8EB, 0xE934, 0xE976, 0xE9AF, 0xE9DE, 0xEA02, 0xEA19, 
+	0x0000, 0xFFFF, 0xBF5E, 0x1644, 0x1641, 0x1639, 0x162D, 0x161D, 0x160A, 
+	0x15F4, 0x15DB, 0x15C1, 0x15A5, 0x1589, 0x156C, 0x1550, 0x1534, 0x151A, 
+	0x1501, 0x14EB, 0x14D8, 0x14C8, 0x14BC, 0x14B4, 0x14B2, 0x14B4, 0x14BC, 
+	0x14C8, 0x14D8, 0x14EB, 0x1501, 0x151A, 0x1534, 0x1550, 0x156C, 0x1589, 
+	0x15A5, 0x15C1, 0x15DB, 0x15F4, 0x160A, 0x161D, 0x162D, 0x1639, 0x1641, 
+	0x1617, 0x1619, 0x1621, 0x162C, 0x163B, 0x164D, 0x1662, 0x1679, 0x1692, 
+	0x16AD, 0x16C7, 0x16E3, 0x16FD, 0x1718, 0x1730, 0x1748, 0x175D, 0x176F, 
+	0x177E, 0x1789, 0x1791, 0x1793, 0x1791, 0x1789, 0x177E, 0x176F, 0x175D, 
+	0x1748, 0x1730, 0x1718, 0x16FD, 0x16E3, 0x16C7, 0x16AD, 0x1692, 0x1679, 
+	0x1662, 0x164D, 0x163B, 0x162C, 0x1621, 0x1619, 0x8DFE, 0x8DF9, 0x8DEC, 
+	0x8DD6, 0x8DB9, 0x8D96, 0x8D6F, 0x8D42, 0x8D13, 0x8CE1, 0x8CAE, 0x8C7A, 
+	0x8C47, 0x8C15, 0x8BE6, 0x8BBA, 0x8B92, 0x8B6F, 0x8B52, 0x8B3D, 0x8B2F, 
+	0x8B2A, 0x8B2F, 0x8B3D, 0x8B52, 0x8B6F, 0x8B92, 0x8BBA, 0x8BE6, 0x8C15, 
+	0x8C47, 0x8C7A, 0x8CAE, 0x8CE1, 0x8D13, 0x8D42, 0x8D6F, 0x8D96, 0x8DB9, 
+	0x8DD6, 0x8DEC, 0x8DF9, 0xFEDD, 0xFEDD, 0xFEDC, 0xFEDB, 0xFED9, 0xFED7, 
+	0xFED4, 0xFED2, 0xFECF, 0xFECC, 0xFEC9, 0xFEC5, 0xFEC2, 0xFEBF, 0xFEBC, 
+	0xFEBA, 0xFEB7, 0xFEB5, 0xFEB3, 0xFEB2, 0xFEB1, 0xFEB1, 0xFEB1, 0xFEB2, 
+	0xFEB3, 0xFEB5, 0xFEB7, 0xFEBA, 0xFEBC, 0xFEBF, 0xFEC2, 0xFEC5, 0xFEC9, 
+	0xFECC, 0xFECF, 0xFED2, 0xFED4, 0xFED7, 0xFED9, 0xFEDB, 0xFEDC, 0xFEDD, 
+	0x0204, 0x0204, 0x0203, 0x0201, 0x01FF, 0x01FC, 0x01FA, 0x01F6, 0x01F3, 
+	0x01EF, 0x01EB, 0x01E8, 0x01E4, 0x01E0, 0x01DD, 0x01DA, 0x01D7, 0x01D4, 
+	0x01D2, 0x01D0, 0x01CF, 0x01CF, 0x01CF, 0x01D0, 0x01D2, 0x01D4, 0x01D7, 
+	0x01DA, 0x01DD, 0x01E0, 0x01E4, 0x01E8, 0x01EB, 0x01EF, 0x01F3, 0x01F6, 
+	0x01FA, 0x01FC, 0x01FF, 0x0201, 0x0203, 0x0204, 0x3560, 0x356C, 0x3591, 
+	0x35CA, 0x3616, 0x3673, 0x36DD, 0x3752, 0x37D0, 0x3854, 0x38DC, 0x3966, 
+	0x39ED, 0x3A72, 0x3AF0, 0x3B65, 0x3BCF, 0x3C2B, 0x3C78, 0x3CB1, 0x3CD5, 
+	0x3CE2, 0x3CD5, 0x3CB1, 0x3C78, 0x3C2B, 0x3BCF, 0x3B65, 0x3AF0, 0x3A72, 
+	0x39ED, 0x3966, 0x38DC, 0x3854, 0x37D0, 0x3752, 0x36DD, 0x3673, 0x3616, 
+	0x35CA, 0x3591, 0x356C, 0x026C, 0x026C, 0x026A, 0x0268, 0x0265, 0x0261, 
+	0x025C, 0x0257, 0x0252, 0x024D, 0x0247, 0x0241, 0x023B, 0x0236, 0x0231, 
+	0x022C, 0x0227, 0x0223, 0x0220, 0x021E, 0x021C, 0x021C, 0x021C, 0x021E, 
+	0x0220, 0x0223, 0x0227, 0x022C, 0x0231, 0x0236, 0x023B, 0x0241, 0x0247, 
+	0x024D, 0x0252, 0x0257, 0x025C, 0x0261, 0x0265, 0x0268, 0x026A, 0x026C, 
+	0x00C0, 0x00C0, 0x00C1, 0x00C3, 0x00C6, 0x00CA, 0x00CD, 0x00D2, 0x00D6, 
+	0x00DB, 0x00E0, 0x00E5, 0x00EA, 0x00EE, 0x00F3, 0x00F7, 0x00FB, 0x00FE, 
+	0x0101, 0x0103, 0x0104, 0x0105, 0x0104, 0x0103, 0x0101, 0x00FE, 0x00FB, 
+	0x00F7, 0x00F3, 0x00EE, 0x00EA, 0x00E5, 0x00E0, 0x00DB, 0x00D6, 0x00D2, 
+	0x00CD, 0x00CA, 0x00C6, 0x00C3, 0x00C1, 0x00C0, 0xBB3A, 0xBB33, 0xBB1C, 
+	0xBAF9, 0xBACB, 0xBA92, 0xBA52, 0xBA0A, 0xB9BD, 0xB96D, 0xB91A, 0xB8C6, 
+	0xB873, 0xB822, 0xB7D6, 0xB78E, 0xB74D, 0xB715, 0xB6E7, 0xB6C3, 0xB6AD, 
+	0xB6A6, 0xB6AD, 0xB6C3, 0xB6E7, 0xB715, 0xB74D, 0xB78E, 0xB7D6, 0xB822, 
+	0xB873, 0xB8C6, 0xB91A, 0xB96D, 0xB9BD, 0xBA0A, 0xBA52, 0xBA92, 0xBACB, 
+	0xBAF9, 0xBB1C, 0xBB33, 
+	},{ 
+	0x0028, 0x0000, 0x0028, 0x0028, 0x0001, 0x0050, 0x0001, 0x0051, 0x0001, 
+	0x0052, 0x0001, 0x0053, 0x0001, 0x0054, 0x0001, 0x0055, 0x0001, 0x0056, 
+	0x0024, 0x0057, 0x0015, 0x007B, 0x002A, 0x0090, 0x0029, 0x00BA, 0x0001, 
+	0x00E3, 0x002A, 0x00E4, 0x0001, 0x010E, 0x0001, 0x010F, 0x0001, 0x0110, 
+	0x002A, 0x0111, 0x002A, 0x013B, 0x002A, 0x0165, 0x0029, 0x018F, 0x0019, 
+	0x01B8, 0x002A, 0x01D1, 0x002A, 0x01FB, 0x002A, 0x0225, 0x002A, 0x024F, 
+	0x0001, 0x0279, 0x0001, 0x027A, 0x0001, 0x027B, 0x002A, 0x027C, 0x002A, 
+	0x02A6, 0x002A, 0x02D0, 0x0001, 0x02FA, 0x0001, 0x02FB, 0x002A, 0x02FC, 
+	0x0029, 0x0326, 0x002A, 0x034F, 0x002A, 0x0379, 0x0001, 0x03A3, 0x0001, 
+	0x03A4, 0x0001, 0x03A5, 0x002A, 0x03A6, 0x002A, 0x03D0, 0x002A, 0x03FA, 
+	0x0016, 0x0424, 0x0014, 0x043A, 0x002A, 0x044E, 0x0029, 0x0478, 0x002A, 
+	0x04A1, 0x002A, 0x04CB, 0x0001, 0x04F5, 0x0001, 0x04F6, 0x0001, 0x04F7, 
+	0x002A, 0x04F8, 0x002A, 0x0522, 0x002A, 0x054C, 0x002A, 0x0576, 0x002A, 
+	0x05A0, 0x002A, 0x05CA, 0x002A, 0x05F4, 0x002A, 0x061E, 0x002A, 0x0648, 
+})
+
+TOAD_PLAYER_ANIM_CS_MENU = "toad_anim_cs_menu"
+smlua_anim_util_register_animation(TOAD_PLAYER_ANIM_CS_MENU,
+	0,
+	0,
+	0,
+	0,
+	41,
+	{ 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 
+	0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 
+	0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 
+	0x0004, 0x0003, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 
+	0x0001, 0x0001, 0x0000, 0x012C, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFE, 0xFFFE, 0xFFFD, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFFB, 0xFFFA, 
+	0xFFFA, 0xFFF9, 0xFFF8, 0xFFF8, 0xFFF8, 0xFFF7, 0xFFF7, 0xFFF7, 0xFFF7, 
+	0xFFF7, 0xFFF8, 0xFFF8, 0xFFF8, 0xFFF9, 0xFFFA, 0xFFFA, 0xFFFB, 0xFFFB, 
+	0xFFFC, 0xFFFD, 0xFFFD, 0xFFFE, 0xFFFE, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x3FFF, 0xFFFF, 0xFFE3, 0xFFE3, 0xFFE2, 0xFFE2, 0xFFE1, 0xFFE1, 0xFFE0, 
+	0xFFDF, 0xFFDE, 0xFFDD, 0xFFDC, 0xFFDB, 0xFFDA, 0xFFD9, 0xFFD8, 0xFFD7, 
+	0xFFD6, 0xFFD5, 0xFFD5, 0xFFD4, 0xFFD4, 0xFFD4, 0xFFD4, 0xFFD4, 0xFFD5, 
+	0xFFD5, 0xFFD6, 0xFFD7, 0xFFD8, 0xFFD9, 0xFFDA, 0xFFDB, 0xFFDC, 0xFFDD, 
+	0xFFDE, 0xFFDF, 0xFFE0, 0xFFE1, 0xFFE1, 0xFFE2, 0xFFE2, 0xFFE3, 0xF8E3, 
+	0xF8DD, 0xF8CC, 0xF8B0, 0xF88C, 0xF861, 0xF82E, 0xF7F7, 0xF7BB, 0xF77D, 
+	0xF73C, 0xF6FB, 0xF6BB, 0xF67C, 0xF641, 0xF609, 0xF5D7, 0xF5AB, 0xF587, 
+	0xF56C, 0xF55B, 0xF555, 0xF55B, 0xF56C, 0xF587, 0xF5AB, 0xF5D7, 0xF609, 
+	0xF641, 0xF67C, 0xF6BB, 0xF6FB, 0xF73C, 0xF77D, 0xF7BB, 0xF7F7, 0xF82E, 
+	0xF861, 0xF88C, 0xF8B0, 0xF8CC, 0xF8DD, 0x40A3, 0x40A3, 0x40A3, 0x40A3, 
+	0x40A3, 0x40A3, 0x40A4, 0x40A4, 0x40A4, 0x40A4, 0x40A4, 0x40A5, 0x40A5, 
+	0x40A5, 0x40A5, 0x40A6, 0x40A6, 0x40A6, 0x40A6, 0x40A6, 0x40A6, 0x40A6, 
+	0x40A6, 0x40A6, 0x40A6, 0x40A6, 0x40A6, 0x40A6, 0x40A5, 0x40A5, 0x40A5, 
+	0x40A5, 0x40A4, 0x40A4, 0x40A4, 0x40A4, 0x40A4, 0x40A3, 0xFFFF, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0x0884, 0xFC56, 0xFC54, 0xFC50, 0xFC49, 0xFC3F, 0xFC34, 0xFC27, 
+	0xFC19, 0xFC0A, 0xFBFA, 0xFBE9, 0xFBD8, 0xFBC8, 0xFBB8, 0xFBA9, 0xFB9A, 
+	0xFB8D, 0xFB82, 0xFB79, 0xFB72, 0xFB6E, 0xFB6C, 0xFB6E, 0xFB72, 0xFB79, 
+	0xFB82, 0xFB8D, 0xFB9A, 0xFBA9, 0xFBB8, 0xFBC8, 0xFBD8, 0xFBE9, 0xFBFA, 
+	0xFC0A, 0xFC19, 0xFC27, 0xFC34, 0xFC3F, 0xFC49, 0xFC50, 0xFC54, 0x0A28, 
+	0x0A31, 0x0A4D, 0x0A78, 0x0AB2, 0x0AF7, 0x0B47, 0x0BA0, 0x0BFF, 0x0C62, 
+	0x0CC9, 0x0D31, 0x0D97, 0x0DFB, 0x0E5A, 0x0EB2, 0x0F02, 0x0F48, 0x0F81, 
+	0x0FAD, 0x0FC8, 0x0FD2, 0x0FC8, 0x0FAD, 0x0F81, 0x0F48, 0x0F02, 0x0EB2, 
+	0x0E5A, 0x0DFB, 0x0D97, 0x0D31, 0x0CC9, 0x0C62, 0x0BFF, 0x0BA0, 0x0B47, 
+	0x0AF7, 0x0AB2, 0x0A78, 0x0A4D, 0x0A31, 0xF89E, 0xF898, 0xF884, 0xF866, 
+	0xF83D, 0xF80C, 0xF7D3, 0xF795, 0xF751, 0xF70B, 0xF6C2, 0xF679, 0xF630, 
+	0xF5EA, 0xF5A7, 0xF568, 0xF530, 0xF4FE, 0xF4D6, 0xF4B7, 0xF4A4, 0xF49D, 
+	0xF4A4, 0xF4B7, 0xF4D6, 0xF4FE, 0xF530, 0xF568, 0xF5A7, 0xF5EA, 0xF630, 
+	0xF679, 0xF6C2, 0xF70B, 0xF751, 0xF795, 0xF7D3, 0xF80C, 0xF83D, 0xF866, 
+	0xF884, 0xF898, 0xFFFE, 0x0001, 0xC170, 0x3654, 0xE59C, 0x3B9C, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFC3, 
+	0xFF20, 0xFE31, 0xFD0E, 0xFBD1, 0xFA94, 0xF971, 0xF881, 0xF7DE, 0xF7A3, 
+	0xF7BD, 0xF80A, 0xF884, 0xF924, 0xF9E6, 0xFAC4, 0xFBB9, 0xFCBE, 0xFDD0, 
+	0xFEE7, 0x0000, 0x0113, 0x021D, 0x0319, 0x0402, 0x04D4, 0x058A, 0x061F, 
+	0x0690, 0x06D7, 0x06EF, 0x06C6, 0x0654, 0x05AB, 0x04DA, 0x03F0, 0x02FF, 
+	0x0215, 0x0144, 0x009B, 0x0029, 0x0000, 0x0023, 0x0044, 0x0065, 0x0083, 
+	0x009F, 0x00B7, 0x00CB, 0x00DA, 0x00E4, 0x00E7, 0x00E5, 0x00DE, 0x00D3, 
+	0x00C4, 0x00B1, 0x009B, 0x0082, 0x0065, 0x0046, 0x0024, 0x0000, 0xFFD9, 
+	0xFFB2, 0xFF8C, 0xFF67, 0xFF44, 0xFF26, 0xFF0C, 0xFEF8, 0xFEEB, 0xFEE6, 
+	0xFEEA, 0xFEF4, 0xFF03, 0xFF17, 0xFF30, 0xFF4D, 0xFF6D, 0xFF8F, 0xFFB3, 
+	0xFFD9, 0xF97B, 0xF97D, 0xF980, 0xF982, 0xF984, 0xF986, 0xF988, 0xF989, 
+	0xF98A, 0xF98B, 0xF98B, 0xF98B, 0xF98A, 0xF988, 0xF986, 0xF984, 0xF982, 
+	0xF980, 0xF97E, 0xF97C, 0xF97B, 0xF97B, 0xF97C, 0xF97D, 0xF980, 0xF983, 
+	0xF987, 0xF98A, 0xF98E, 0xF990, 0xF992, 0xF993, 0xF992, 0xF991, 0xF990, 
+	0xF98E, 0xF98C, 0xF98A, 0xF987, 0xF984, 0xF981, 0xF97E, 0xED8B, 0xECB1, 
+	0xEBDC, 0xEB0F, 0xEA50, 0xE9A2, 0xE90A, 0xE88C, 0xE82C, 0xE7F0, 0xE7DB, 
+	0xE7E9, 0xE814, 0xE859, 0xE8B8, 0xE92E, 0xE9BA, 0xEA5B, 0xEB0E, 0xEBD3, 
+	0xECA8, 0xED8B, 0xEE7A, 0xEF6E, 0xF061, 0xF14B, 0xF224, 0xF2E6, 0xF38A, 
+	0xF408, 0xF459, 0xF475, 0xF460, 0xF423, 0xF3C2, 0xF341, 0xF2A4, 0xF1EF, 
+	0xF126, 0xF04D, 0xEF68, 0xEE7C, 0xFFFE, 0x0001, 0xC170, 0x20DC, 0x20E4, 
+	0x20FA, 0x211D, 0x214C, 0x2184, 0x21C5, 0x220D, 0x225B, 0x22AC, 0x22FF, 
+	0x2353, 0x23A6, 0x23F7, 0x2445, 0x248C, 0x24CD, 0x2506, 0x2535, 0x2558, 
+	0x256E, 0x2576, 0x256E, 0x2558, 0x2535, 0x2506, 0x24CD, 0x248C, 0x2445, 
+	0x23F7, 0x23A6, 0x2353, 0x22FF, 0x22AC, 0x225B, 0x220D, 0x21C5, 0x2184, 
+	0x214C, 0x211D, 0x20FA, 0x20E4, 0x20E0, 0x20DF, 0x20DB, 0x20D6, 0x20CF, 
+	0x20C7, 0x20BD, 0x20B3, 0x20A8, 0x209C, 0x208F, 0x2083, 0x2077, 0x206B, 
+	0x205F, 0x2055, 0x204B, 0x2043, 0x203C, 0x2037, 0x2034, 0x2032, 0x2034, 
+	0x2037, 0x203C, 0x2043, 0x204B, 0x2055, 0x205F, 0x206B, 0x2077, 0x2083, 
+	0x208F, 0x209C, 0x20A7, 0x20B3, 0x20BD, 0x20C7, 0x20CF, 0x20D6, 0x20DB, 
+	0x20DF, 0xD0CB, 0xD0DB, 0xD109, 0xD152, 0xD1B2, 0xD226, 0xD2AC, 0xD340, 
+	0xD3DF, 0xD485, 0xD531, 0xD5DE, 0xD689, 0xD730, 0xD7CF, 0xD863, 0xD8E8, 
+	0xD95D, 0xD9BD, 0xDA05, 0xDA33, 0xDA43, 0xDA33, 0xDA05, 0xD9BD, 0xD95D, 
+	0xD8E8, 0xD863, 0xD7CF, 0xD730, 0xD689, 0xD5DE, 0xD531, 0xD485, 0xD3DF, 
+	0xD340, 0xD2AC, 0xD226, 0xD1B2, 0xD152, 0xD109, 0xD0DB, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFF9, 0xFFE7, 0xFFCA, 
+	0xFFA4, 0xFF76, 0xFF42, 0xFF07, 0xFEC9, 0xFE87, 0xFE44, 0xFDFF, 0xFDBC, 
+	0xFD7A, 0xFD3C, 0xFD01, 0xFCCD, 0xFC9F, 0xFC79, 0xFC5C, 0xFC4A, 0xFC44, 
+	0xFC4A, 0xFC5C, 0xFC79, 0xFC9F, 0xFCCD, 0xFD01, 0xFD3C, 0xFD7A, 0xFDBC, 
+	0xFDFF, 0xFE44, 0xFE87, 0xFEC9, 0xFF07, 0xFF42, 0xFF76, 0xFFA4, 0xFFCA, 
+	0xFFE7, 0xFFF9, 0xFFFF, 0x0016, 0x0056, 0x00BB, 0x0141, 0x01E3, 0x029E, 
+	0x036C, 0x0449, 0x0531, 0x0620, 0x0711, 0x0800, 0x08E9, 0x09C6, 0x0A94, 
+	0x0B4E, 0x0BF1, 0x0C76, 0x0CDC, 0x0D1B, 0x0D32, 0x0D1B, 0x0CDC, 0x0C76, 
+	0x0BF1, 0x0B4E, 0x0A94, 0x09C6, 0x08E9, 0x0800, 0x0711, 0x0620, 0x0531, 
+	0x0449, 0x036C, 0x029E, 0x01E3, 0x0141, 0x00BB, 0x0056, 0x0016, 0xF548, 
+	0xF547, 0xF544, 0xF540, 0xF53A, 0xF532, 0xF52A, 0xF521, 0xF517, 0xF50C, 
+	0xF502, 0xF4F7, 0xF4EC, 0xF4E2, 0xF4D8, 0xF4CF, 0xF4C6, 0xF4BF, 0xF4B9, 
+	0xF4B5, 0xF4B2, 0xF4B1, 0xF4B2, 0xF4B5, 0xF4B9, 0xF4BF, 0xF4C6, 0xF4CF, 
+	0xF4D8, 0xF4E2, 0xF4EC, 0xF4F7, 0xF502, 0xF50C, 0xF517, 0xF521, 0xF52A, 
+	0xF532, 0xF53A, 0xF540, 0xF544, 0xF547, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xBF5E, 0xD227, 
+	0xF622, 0xBEC5, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x2537, 
+	0x1DEE, 0x1DEB, 0x1DE0, 0x1DCF, 0x1DB9, 0x1D9E, 0x1D7F, 0x1D5D, 0x1D38, 
+	0x1D12, 0x1CEA, 0x1CC2, 0x1C9B, 0x1C74, 0x1C50, 0x1C2D, 0x1C0F, 0x1BF4, 
+	0x1BDD, 0x1BCD, 0x1BC2, 0x1BBE, 0x1BC2, 0x1BCD, 0x1BDD, 0x1BF4, 0x1C0F, 
+	0x1C2D, 0x1C50, 0x1C74, 0x1C9B, 0x1CC2, 0x1CEA, 0x1D12, 0x1D38, 0x1D5D, 
+	0x1D7F, 0x1D9E, 0x1DB9, 0x1DCF, 0x1DE0, 0x1DEB, 0x105C, 0x1063, 0x1075, 
+	0x1093, 0x10BA, 0x10EA, 0x1121, 0x115E, 0x119F, 0x11E3, 0x1229, 0x1270, 
+	0x12B7, 0x12FB, 0x133C, 0x1379, 0x13AF, 0x13DF, 0x1407, 0x1424, 0x1437, 
+	0x143E, 0x1437, 0x1424, 0x1407, 0x13DF, 0x13AF, 0x1379, 0x133C, 0x12FB, 
+	0x12B7, 0x1270, 0x1229, 0x11E3, 0x119F, 0x115E, 0x1121, 0x10EA, 0x10BA, 
+	0x1093, 0x1075, 0x1063, 0xCCA9, 0xCCA0, 0xCC88, 0xCC62, 0xCC2F, 0xCBF1, 
+	0xCBAA, 0xCB5B, 0xCB07, 0xCAAE, 0xCA53, 0xC9F8, 0xC99D, 0xC944, 0xC8F0, 
+	0xC8A1, 0xC85A, 0xC81C, 0xC7E9, 0xC7C3, 0xC7AB, 0xC7A2, 0xC7AB, 0xC7C3, 
+	0xC7E9, 0xC81C, 0xC85A, 0xC8A1, 0xC8F0, 0xC944, 0xC99D, 0xC9F8, 0xCA53, 
+	0xCAAE, 0xCB07, 0xCB5B, 0xCBAA, 0xCBF1, 0xCC2F, 0xCC62, 0xCC88, 0xCCA0, 
+	0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0xBF5E, 0x0C12, 0x0C13, 0x0C17, 0x0C1C, 0x0C23, 0x0C2C, 
+	0x0C36, 0x0C41, 0x0C4D, 0x0C59, 0x0C66, 0x0C73, 0x0C80, 0x0C8C, 0x0C98, 
+	0x0CA3, 0x0CAD, 0x0CB6, 0x0CBD, 0x0CC2, 0x0CC6, 0x0CC7, 0x0CC6, 0x0CC2, 
+	0x0CBD, 0x0CB6, 0x0CAD, 0x0CA3, 0x0C98, 0x0C8C, 0x0C80, 0x0C73, 0x0C66, 
+	0x0C59, 0x0C4D, 0x0C41, 0x0C36, 0x0C2C, 0x0C23, 0x0C1C, 0x0C17, 0x0C13, 
+	0x052E, 0x0520, 0x04F9, 0x04BB, 0x0468, 0x0404, 0x0391, 0x0312, 0x0289, 
+	0x01FA, 0x0166, 0x00D1, 0x003E, 0xFFAE, 0xFF25, 0xFEA6, 0xFE33, 0xFDCF, 
+	0xFD7C, 0xFD3E, 0xFD16, 0xFD08, 0xFD16, 0xFD3E, 0xFD7C, 0xFDCF, 0xFE33, 
+	0xFEA6, 0xFF25, 0xFFAE, 0x003E, 0x00D1, 0x0166, 0x01FA, 0x0289, 0x0312, 
+	0x0391, 0x0404, 0x0468, 0x04BB, 0x04F9, 0x0520, 0xAFF2, 0xB01C, 0xB095, 
+	0xB154, 0xB252, 0xB386, 0xB4E7, 0xB66E, 0xB812, 0xB9CB, 0xBB90, 0xBD59, 
+	0xBF1E, 0xC0D6, 0xC27A, 0xC401, 0xC562, 0xC696, 0xC794, 0xC853, 0xC8CC, 
+	0xC8F7, 0xC8CC, 0xC853, 0xC794, 0xC696, 0xC562, 0xC401, 0xC27A, 0xC0D6, 
+	0xBF1E, 0xBD59, 0xBB90, 0xB9CB, 0xB812, 0xB66E, 0xB4E7, 0xB386, 0xB252, 
+	0xB154, 0xB095, 0xB01C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFC2, 0x00E3, 0x00E6, 
+	0x00EF, 0x00FD, 0x010F, 0x0125, 0x013E, 0x015A, 0x0178, 0x0198, 0x01B8, 
+	0x01D9, 0x01FA, 0x0219, 0x0237, 0x0253, 0x026D, 0x0283, 0x0295, 0x02A3, 
+	0x02AB, 0x02AE, 0x02AB, 0x02A3, 0x0295, 0x0283, 0x026D, 0x0253, 0x0237, 
+	0x0219, 0x01FA, 0x01D9, 0x01B8, 0x0198, 0x0178, 0x015A, 0x013E, 0x0125, 
+	0x010F, 0x00FD, 0x00EF, 0x00E6, 0x0633, 0x0632, 0x0630, 0x062B, 0x0626, 
+	0x061F, 0x0618, 0x060F, 0x0606, 0x05FD, 0x05F3, 0x05E9, 0x05E0, 0x05D6, 
+	0x05CD, 0x05C5, 0x05BD, 0x05B7, 0x05B1, 0x05AD, 0x05AB, 0x05AA, 0x05AB, 
+	0x05AD, 0x05B1, 0x05B7, 0x05BD, 0x05C5, 0x05CD, 0x05D6, 0x05E0, 0x05E9, 
+	0x05F3, 0x05FD, 0x0606, 0x060F, 0x0618, 0x061F, 0x0626, 0x062B, 0x0630, 
+	0x0632, 0xBF73, 0xBF88, 0xBFC3, 0xC021, 0xC09E, 0xC135, 0xC1E2, 0xC2A2, 
+	0xC370, 0xC448, 0xC526, 0xC606, 0xC6E4, 0xC7BD, 0xC88A, 0xC94A, 0xC9F7, 
+	0xCA8E, 0xCB0B, 0xCB69, 0xCBA4, 0xCBB9, 0xCBA4, 0xCB69, 0xCB0B, 0xCA8E, 
+	0xC9F7, 0xC94A, 0xC88A, 0xC7BD, 0xC6E4, 0xC606, 0xC526, 0xC448, 0xC370, 
+	0xC2A2, 0xC1E2, 0xC135, 0xC09E, 0xC021, 0xBFC3, 0xBF88, 
+	},{ 
+	0x0027, 0x0000, 0x0001, 0x0027, 0x0028, 0x0028, 0x0001, 0x0050, 0x0001, 
+	0x0051, 0x0001, 0x0052, 0x002A, 0x0053, 0x002A, 0x007D, 0x0026, 0x00A7, 
+	0x002A, 0x00CD, 0x002A, 0x00F7, 0x0001, 0x0121, 0x002A, 0x0122, 0x002A, 
+	0x014C, 0x002A, 0x0176, 0x0001, 0x01A0, 0x0001, 0x01A1, 0x0001, 0x01A2, 
+	0x0001, 0x01A3, 0x0001, 0x01A4, 0x0001, 0x01A5, 0x0028, 0x01A6, 0x0028, 
+	0x01CE, 0x002A, 0x01F6, 0x002A, 0x0220, 0x002A, 0x024A, 0x002A, 0x0274, 
+	0x0001, 0x029E, 0x0001, 0x029F, 0x0001, 0x02A0, 0x002A, 0x02A1, 0x002A, 
+	0x02CB, 0x002A, 0x02F5, 0x002A, 0x031F, 0x002A, 0x0349, 0x0028, 0x0373, 
+	0x002A, 0x039B, 0x002A, 0x03C5, 0x002A, 0x03EF, 0x002A, 0x0419, 0x0029, 
+	0x0443, 0x0001, 0x046C, 0x0001, 0x046D, 0x0001, 0x046E, 0x0001, 0x046F, 
+	0x0028, 0x0470, 0x0026, 0x0498, 0x0001, 0x04BE, 0x002A, 0x04BF, 0x002A, 
+	0x04E9, 0x002A, 0x0513, 0x002A, 0x053D, 0x0029, 0x0567, 0x0001, 0x0590, 
+	0x002A, 0x0591, 0x002A, 0x05BB, 0x002A, 0x05E5, 0x0026, 0x060F, 0x0001, 
+	0x0635, 0x0001, 0x0636, 0x002A, 0x0637, 0x002A, 0x0661, 0x002A, 0x068B, 
+})
+
+WALUIGI_ANIM_CS_MENU = "waluigi_anim_cs_menu"
+smlua_anim_util_register_animation(WALUIGI_ANIM_CS_MENU,
+	0,
+	0,
+	0,
+	0,
+	41,
+	{ 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFE, 0xFFFE, 
+	0xFFFD, 0xFFFD, 0xFFFC, 0xFFFB, 0xFFFB, 0xFFFA, 0xFFFA, 0xFFFA, 0xFFF9, 
+	0xFFF9, 0xFFF9, 0xFFF9, 0xFFF8, 0xFFF9, 0xFFF9, 0xFFF9, 0xFFF9, 0xFFFA, 
+	0xFFFA, 0xFFFA, 0xFFFB, 0xFFFB, 0xFFFC, 0xFFFD, 0xFFFD, 0xFFFE, 0xFFFE, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 
+	0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x006A, 0x0069, 
+	0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 
+	0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x006A, 0x0000, 
+	0x0000, 0x36B8, 0x0000, 0xFFFF, 0xFFFF, 0x40A1, 0x0D70, 0x0D77, 0x0D8A, 
+	0x0DA9, 0x0DD2, 0x0E04, 0x0E3D, 0x0E7C, 0x0EC0, 0x0F07, 0x0F51, 0x0F9B, 
+	0x0FE4, 0x102B, 0x106F, 0x10AE, 0x10E7, 0x1119, 0x1142, 0x1161, 0x1174, 
+	0x117B, 0x1174, 0x1161, 0x1142, 0x1119, 0x10E7, 0x10AE, 0x106F, 0x102B, 
+	0x0FE4, 0x0F9B, 0x0F51, 0x0F07, 0x0EC0, 0x0E7C, 0x0E3D, 0x0E04, 0x0DD2, 
+	0x0DA9, 0x0D8A, 0x0D77, 0x0C44, 0x0C48, 0x0C53, 0x0C64, 0x0C7B, 0x0C97, 
+	0x0CB7, 0x0CDA, 0x0D00, 0x0D28, 0x0D51, 0x0D7B, 0x0DA4, 0x0DCC, 0x0DF2, 
+	0x0E15, 0x0E35, 0x0E51, 0x0E68, 0x0E79, 0x0E84, 0x0E88, 0x0E84, 0x0E79, 
+	0x0E68, 0x0E51, 0x0E35, 0x0E15, 0x0DF2, 0x0DCC, 0x0DA4, 0x0D7B, 0x0D51, 
+	0x0D28, 0x0D00, 0x0CDA, 0x0CB7, 0x0C97, 0x0C7B, 0x0C64, 0x0C53, 0x0C48, 
+	0x27F5, 0x27F9, 0x2805, 0x2818, 0x2832, 0x2850, 0x2873, 0x289A, 0x28C4, 
+	0x28F0, 0x291D, 0x294B, 0x2978, 0x29A4, 0x29CE, 0x29F4, 0x2A18, 0x2A36, 
+	0x2A50, 0x2A63, 0x2A6F, 0x2A73, 0x2A6F, 0x2A63, 0x2A50, 0x2A36, 0x2A18, 
+	0x29F4, 0x29CE, 0x29A4, 0x2978, 0x294B, 0x291D, 0x28F0, 0x28C4, 0x289A, 
+	0x2873, 0x2850, 0x2832, 0x2818, 0x2805, 0x27F9, 0xF280, 0xF2AF, 0xF2DA, 
+	0xF2FE, 0xF316, 0xF31F, 0xF31A, 0xF30D, 0xF2F9, 0xF2DE, 0xF2BD, 0xF298, 
+	0xF270, 0xF245, 0xF218, 0xF1EB, 0xF1BF, 0xF194, 0xF16C, 0xF147, 0xF126, 
+	0xF10C, 0xF0F7, 0xF0E8, 0xF0DD, 0xF0D7, 0xF0D3, 0xF0D2, 0xF0D1, 0xF0D5, 
+	0xF0DE, 0xF0ED, 0xF101, 0xF11A, 0xF137, 0xF158, 0xF17C, 0xF1A3, 0xF1CC, 
+	0xF1F8, 0xF224, 0xF252, 0xF722, 0xF6DF, 0xF6A1, 0xF66F, 0xF64D, 0xF640, 
+	0xF647, 0xF65C, 0xF67D, 0xF6A8, 0xF6DD, 0xF71A, 0xF75E, 0xF7A7, 0xF7F3, 
+	0xF842, 0xF892, 0xF8E2, 0xF92F, 0xF97A, 0xF9C0, 0xFA00, 0xFA39, 0xFA6B, 
+	0xFA94, 0xFAB5, 0xFACD, 0xFADB, 0xFAE0, 0xFAD9, 0xFAC4, 0xFAA3, 0xFA76, 
+	0xFA3F, 0xF9FE, 0xF9B5, 0xF964, 0xF90D, 0xF8B1, 0xF851, 0xF7EE, 0xF788, 
+	0xE0D7, 0xE009, 0xDF4C, 0xDEB0, 0xDE46, 0xDE1F, 0xDE34, 0xDE71, 0xDED2, 
+	0xDF52, 0xDFED, 0xE09F, 0xE163, 0xE236, 0xE313, 0xE3F6, 0xE4DA, 0xE5BC, 
+	0xE697, 0xE767, 0xE827, 0xE8D4, 0xE96A, 0xE9E8, 0xEA4F, 0xEA9F, 0xEAD8, 
+	0xEAF9, 0xEB05, 0xEAF1, 0xEAB9, 0xEA5E, 0xE9E4, 0xE94D, 0xE89D, 0xE7D6, 
+	0xE6FC, 0xE610, 0xE516, 0xE410, 0xE302, 0xE1EE, 0xFFFE, 0x0001, 0xC170, 
+	0x26EA, 0x26F6, 0x271A, 0x2752, 0x279C, 0x27F6, 0x285D, 0x28D0, 0x294A, 
+	0x29CB, 0x2A4F, 0x2AD5, 0x2B59, 0x2BDA, 0x2C55, 0x2CC7, 0x2D2F, 0x2D88, 
+	0x2DD3, 0x2E0B, 0x2E2E, 0x2E3A, 0x2E2E, 0x2E0B, 0x2DD3, 0x2D88, 0x2D2F, 
+	0x2CC7, 0x2C55, 0x2BDA, 0x2B59, 0x2AD5, 0x2A4F, 0x29CB, 0x294A, 0x28D0, 
+	0x285D, 0x27F6, 0x279C, 0x2752, 0x271A, 0x26F6, 0xCA92, 0xCA98, 0xCAAC, 
+	0xCACB, 0xCAF4, 0xCB25, 0xCB5E, 0xCB9D, 0xCBE1, 0xCC28, 0xCC70, 0xCCBA, 
+	0xCD03, 0xCD4A, 0xCD8E, 0xCDCD, 0xCE05, 0xCE37, 0xCE60, 0xCE7F, 0xCE92, 
+	0xCE99, 0xCE92, 0xCE7F, 0xCE60, 0xCE37, 0xCE05, 0xCDCD, 0xCD8E, 0xCD4A, 
+	0xCD03, 0xCCBA, 0xCC70, 0xCC28, 0xCBE1, 0xCB9D, 0xCB5E, 0xCB25, 0xCAF4, 
+	0xCACB, 0xCAAC, 0xCA98, 0xAF0D, 0xAF01, 0xAEDB, 0xAEA1, 0xAE53, 0xADF5, 
+	0xAD88, 0xAD11, 0xAC90, 0xAC09, 0xAB7E, 0xAAF2, 0xAA67, 0xA9E0, 0xA960, 
+	0xA8E8, 0xA87C, 0xA81D, 0xA7D0, 0xA795, 0xA770, 0xA763, 0xA770, 0xA795, 
+	0xA7D0, 0xA81D, 0xA87C, 0xA8E8, 0xA960, 0xA9E0, 0xAA67, 0xAAF2, 0xAB7E, 
+	0xAC09, 0xAC90, 0xAD11, 0xAD88, 0xADF5, 0xAE53, 0xAEA1, 0xAEDB, 0xAF00, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xBE3D, 0xBE42, 0xBE50, 0xBE65, 0xBE82, 
+	0xBEA5, 0xBECC, 0xBEF8, 0xBF28, 0xBF59, 0xBF8C, 0xBFC0, 0xBFF3, 0xC024, 
+	0xC053, 0xC07F, 0xC0A7, 0xC0CA, 0xC0E6, 0xC0FC, 0xC10A, 0xC10E, 0xC10A, 
+	0xC0FC, 0xC0E6, 0xC0CA, 0xC0A7, 0xC07F, 0xC053, 0xC024, 0xBFF3, 0xBFC0, 
+	0xBF8C, 0xBF59, 0xBF28, 0xBEF8, 0xBECC, 0xBEA5, 0xBE82, 0xBE65, 0xBE50, 
+	0xBE42, 0x0F42, 0xFBB0, 0xDC2A, 0xFFFE, 0x0001, 0xC170, 0x4E55, 0x4E5E, 
+	0x4E77, 0x4E9F, 0x4ED4, 0xCF14, 0xCF5E, 0xCFB0, 0xD007, 0xD063, 0xD0C2, 
+	0xD121, 0xD180, 0xD1DC, 0xD233, 0xD285, 0xD2CF, 0xD30F, 0xD344, 0xD36C, 
+	0xD385, 0xD38E, 0xD385, 0xD36C, 0xD344, 0xD30F, 0xD2CF, 0xD285, 0xD233, 
+	0xD1DC, 0xD180, 0xD121, 0xD0C2, 0xD063, 0xD007, 0xCFB0, 0xCF5E, 0xCF14, 
+	0x4ED4, 0x4E9F, 0x4E77, 0x4E5E, 0x58A6, 0x589A, 0x5879, 0x5845, 0x5800, 
+	0x2853, 0x28B3, 0x291D, 0x298F, 0x2A06, 0x2A81, 0x2AFD, 0x2B78, 0x2BF0, 
+	0x2C62, 0x2CCC, 0x2D2C, 0x2D7F, 0x2DC4, 0x2DF8, 0x2E19, 0x2E24, 0x2E19, 
+	0x2DF8, 0x2DC4, 0x2D7F, 0x2D2C, 0x2CCC, 0x2C62, 0x2BF0, 0x2B78, 0x2AFD, 
+	0x2A81, 0x2A06, 0x298F, 0x291D, 0x28B3, 0x2853, 0x5800, 0x5845, 0x5879, 
+	0x589A, 0x1897, 0x18A1, 0x18BE, 0x18EC, 0x1929, 0x9972, 0x99C7, 0x9A24, 
+	0x9A89, 0x9AF3, 0x9B60, 0x9BCD, 0x9C3A, 0x9CA4, 0x9D08, 0x9D66, 0x9DBB, 
+	0x9E05, 0x9E41, 0x9E6F, 0x9E8C, 0x9E97, 0x9E8C, 0x9E6F, 0x9E41, 0x9E05, 
+	0x9DBB, 0x9D66, 0x9D08, 0x9CA4, 0x9C3A, 0x9BCD, 0x9B60, 0x9AF3, 0x9A89, 
+	0x9A24, 0x99C7, 0x9972, 0x1929, 0x18EC, 0x18BE, 0x18A1, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0xB7ED, 0xB7DE, 0xB7B5, 0xB774, 0xB71E, 0xB6B6, 
+	0xB63E, 0xB5B9, 0xB52B, 0xB496, 0xB3FC, 0xB361, 0xB2C7, 0xB232, 0xB1A4, 
+	0xB11F, 0xB0A7, 0xB03F, 0xAFE9, 0xAFA8, 0xAF7F, 0xAF70, 0xAF7F, 0xAFA8, 
+	0xAFE9, 0xB03F, 0xB0A7, 0xB11F, 0xB1A4, 0xB232, 0xB2C7, 0xB361, 0xB3FC, 
+	0xB496, 0xB52B, 0xB5B9, 0xB63E, 0xB6B6, 0xB71E, 0xB774, 0xB7B5, 0xB7DE, 
+	0xE202, 0xE1FC, 0xE1EA, 0xE1CE, 0xE1AA, 0xE17D, 0xE14A, 0xE111, 0xE0D4, 
+	0xE094, 0xE052, 0xE010, 0xDFCE, 0xDF8E, 0xDF51, 0xDF18, 0xDEE5, 0xDEB8, 
+	0xDE93, 0xDE78, 0xDE66, 0xDE60, 0xDE66, 0xDE78, 0xDE93, 0xDEB8, 0xDEE5, 
+	0xDF18, 0xDF51, 0xDF8E, 0xDFCE, 0xE010, 0xE052, 0xE094, 0xE0D4, 0xE111, 
+	0xE14A, 0xE17D, 0xE1AA, 0xE1CE, 0xE1EA, 0xE1FC, 0xF2BC, 0xF2BF, 0xF2C9, 
+	0xF2D9, 0xF2EE, 0xF307, 0xF324, 0xF344, 0xF366, 0xF38B, 0xF3B0, 0xF3D5, 
+	0xF3FB, 0xF41F, 0xF441, 0xF461, 0xF47F, 0xF498, 0xF4AD, 0xF4BC, 0xF4C6, 
+	0xF4CA, 0xF4C6, 0xF4BC, 0xF4AD, 0xF498, 0xF47F, 0xF461, 0xF441, 0xF41F, 
+	0xF3FB, 0xF3D5, 0xF3B0, 0xF38B, 0xF366, 0xF344, 0xF324, 0xF307, 0xF2EE, 
+	0xF2D9, 0xF2C9, 0xF2BF, 0x0B5C, 0x0B62, 0x0B75, 0x0B94, 0x0BBC, 0x0BEC, 
+	0x0C24, 0x0C61, 0x0CA4, 0x0CE9, 0x0D30, 0x0D78, 0x0DC0, 0x0E05, 0x0E47, 
+	0x0E85, 0x0EBD, 0x0EED, 0x0F15, 0x0F33, 0x0F46, 0x0F4D, 0x0F46, 0x0F33, 
+	0x0F15, 0x0EED, 0x0EBD, 0x0E85, 0x0E47, 0x0E05, 0x0DC0, 0x0D78, 0x0D30, 
+	0x0CE9, 0x0CA4, 0x0C61, 0x0C24, 0x0BEC, 0x0BBC, 0x0B94, 0x0B75, 0x0B62, 
+	0xFFFF, 0x0000, 0xBF5E, 0xFBBD, 0xD39A, 0x85AE, 0xFFFF, 0x0002, 0x0006, 
+	0x000D, 0x0017, 0x0022, 0x002F, 0x003E, 0x004E, 0x005E, 0x006F, 0x0080, 
+	0x0091, 0x00A1, 0x00B1, 0x00C0, 0x00CD, 0x00D8, 0x00E2, 0x00E9, 0x00ED, 
+	0x00EF, 0x00ED, 0x00E9, 0x00E2, 0x00D8, 0x00CD, 0x00C0, 0x00B1, 0x00A1, 
+	0x0091, 0x0080, 0x006F, 0x005E, 0x004E, 0x003E, 0x002F, 0x0022, 0x0017, 
+	0x000D, 0x0006, 0x0002, 0x0000, 0xFFFA, 0xFFEC, 0xFFD6, 0xFFB8, 0xFF94, 
+	0xFF6B, 0xFF3E, 0xFF0D, 0xFEDA, 0xFEA5, 0xFE70, 0xFE3B, 0xFE08, 0xFDD7, 
+	0xFDA9, 0xFD80, 0xFD5C, 0xFD3F, 0xFD28, 0xFD1A, 0xFD15, 0xFD1A, 0xFD28, 
+	0xFD3F, 0xFD5C, 0xFD80, 0xFDA9, 0xFDD7, 0xFE08, 0xFE3B, 0xFE70, 0xFEA5, 
+	0xFEDA, 0xFF0D, 0xFF3E, 0xFF6B, 0xFF94, 0xFFB8, 0xFFD6, 0xFFEC, 0xFFFA, 
+	0x35B3, 0x35AD, 0x359F, 0x3588, 0x356A, 0x3545, 0x351A, 0x34EC, 0x34B9, 
+	0x3485, 0x344E, 0x3418, 0x33E1, 0x33AD, 0x337A, 0x334B, 0x3321, 0x32FC, 
+	0x32DE, 0x32C7, 0x32B8, 0x32B3, 0x32B8, 0x32C7, 0x32DE, 0x32FC, 0x3321, 
+	0x334B, 0x337A, 0x33AD, 0x33E1, 0x3418, 0x344E, 0x3485, 0x34B9, 0x34EC, 
+	0x351A, 0x3545, 0x356A, 0x3588, 0x359F, 0x35AD, 0x0000, 0xFFFA, 0xFFED, 
+	0xFFD7, 0xFFBB, 0xFF9A, 0xFF74, 0xFF4B, 0xFF20, 0xFEF4, 0xFEC8, 0xFE9D, 
+	0xFE74, 0xFE4C, 0xFE27, 0xFE04, 0xFDE4, 0xFDC8, 0xFDAE, 0xFD99, 0xFD88, 
+	0xFD7B, 0xFD73, 0xFD71, 0xFD82, 0xFDAA, 0xFDDA, 0xFE02, 0xFE13, 0xFE02, 
+	0xFDDA, 0xFDAA, 0xFD82, 0xFD71, 0xFD77, 0xFD90, 0xFDC2, 0xFE13, 0xFE86, 
+	0xFF08, 0xFF82, 0xFFDC, 0xFFFF, 0x0000, 0x0001, 0x0002, 0x0004, 0x0005, 
+	0x0007, 0x0009, 0x000A, 0x000B, 0x000B, 0x0008, 0x0001, 0xFFF5, 0xFFE7, 
+	0xFFD7, 0xFFC6, 0xFFB4, 0xFFA3, 0xFF93, 0xFF85, 0xFF7A, 0xFF73, 0xFF71, 
+	0xFF86, 0xFFBA, 0xFFF8, 0x002D, 0x0043, 0x002D, 0xFFF8, 0xFFBA, 0xFF86, 
+	0xFF71, 0xFF91, 0xFFD9, 0x0022, 0x0043, 0x003C, 0x002B, 0x0017, 0x0007, 
+	0xD567, 0xD576, 0xD59F, 0xD5DC, 0xD625, 0xD675, 0xD6C6, 0xD70F, 0xD74C, 
+	0xD775, 0xD784, 0xD731, 0xD647, 0xD4E4, 0xD321, 0xD11B, 0xCEEC, 0xCCAF, 
+	0xCA7F, 0xC879, 0xC6B6, 0xC553, 0xC46A, 0xC416, 0xC608, 0xCAAB, 0xD034, 
+	0xD4D7, 0xD6C9, 0xD4D7, 0xD034, 0xCAAB, 0xC608, 0xC416, 0xC702, 0xCD6F, 
+	0xD3DD, 0xD6C9, 0xD6A4, 0xD64C, 0xD5E3, 0xD58B, 0xFFFF, 0x0000, 0xBF5E, 
+	0x0E87, 0x0E8C, 0x0E9A, 0x0EB1, 0x0ECF, 0x0EF3, 0x0F1D, 0x0F4B, 0x0F7D, 
+	0x0FB1, 0x0FE7, 0x101D, 0x1052, 0x1086, 0x10B8, 0x10E6, 0x1110, 0x1134, 
+	0x1152, 0x1169, 0x1177, 0x117C, 0x1177, 0x1169, 0x1152, 0x1134, 0x1110, 
+	0x10E6, 0x10B8, 0x1086, 0x1052, 0x101D, 0x0FE7, 0x0FB1, 0x0F7D, 0x0F4B, 
+	0x0F1D, 0x0EF3, 0x0ECF, 0x0EB1, 0x0E9A, 0x0E8C, 0x1C6D, 0x1C6A, 0x1C63, 
+	0x1C58, 0x1C49, 0x1C36, 0x1C21, 0x1C0A, 0x1BF1, 0x1BD6, 0x1BBB, 0x1BA0, 
+	0x1B85, 0x1B6B, 0x1B52, 0x1B3A, 0x1B25, 0x1B13, 0x1B04, 0x1AF8, 0x1AF1, 
+	0x1AEF, 0x1AF1, 0x1AF8, 0x1B04, 0x1B13, 0x1B25, 0x1B3A, 0x1B52, 0x1B6B, 
+	0x1B85, 0x1BA0, 0x1BBB, 0x1BD6, 0x1BF1, 0x1C0A, 0x1C21, 0x1C36, 0x1C49, 
+	0x1C58, 0x1C63, 0x1C6A, 0x9566, 0x9569, 0x9572, 0x957F, 0x9591, 0x95A6, 
+	0x95BE, 0x95D9, 0x95F6, 0x9615, 0x9634, 0x9654, 0x9673, 0x9692, 0x96AF, 
+	0x96CA, 0x96E2, 0x96F7, 0x9709, 0x9716, 0x971F, 0x9721, 0x971F, 0x9716, 
+	0x9709, 0x96F7, 0x96E2, 0x96CA, 0x96AF, 0x9692, 0x9673, 0x9654, 0x9634, 
+	0x9615, 0x95F6, 0x95D9, 0x95BE, 0x95A6, 0x9591, 0x957F, 0x9572, 0x9569, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x520C, 0x5210, 
+	0x521B, 0x522C, 0x5243, 0x525E, 0x527E, 0x52A1, 0x52C6, 0x52EE, 0x5316, 
+	0x533F, 0x5368, 0x538F, 0x53B5, 0x53D8, 0x53F7, 0x5413, 0x5429, 0x543B, 
+	0x5445, 0x5449, 0x5445, 0x543B, 0x5429, 0x5413, 0x53F7, 0x53D8, 0x53B5, 
+	0x538F, 0x5368, 0x533F, 0x5316, 0x52EE, 0x52C6, 0x52A1, 0x527E, 0x525E, 
+	0x5243, 0x522C, 0x521B, 0x5210, 0x008D, 0x0089, 0x007F, 0x0070, 0x005B, 
+	0x0041, 0x0024, 0x0003, 0xFFE0, 0xFFBB, 0xFF96, 0xFF70, 0xFF4A, 0xFF26, 
+	0xFF03, 0xFEE3, 0xFEC6, 0xFEAC, 0xFE97, 0xFE87, 0xFE7D, 0xFE7A, 0xFE7D, 
+	0xFE87, 0xFE97, 0xFEAC, 0xFEC6, 0xFEE3, 0xFF03, 0xFF26, 0xFF4A, 0xFF70, 
+	0xFF96, 0xFFBB, 0xFFE0, 0x0003, 0x0024, 0x0041, 0x005B, 0x0070, 0x007F, 
+	0x0089, 0xFF66, 0xFF68, 0xFF6C, 0xFF73, 0xFF7C, 0xFF87, 0xFF93, 0xFFA1, 
+	0xFFB0, 0xFFC0, 0xFFD0, 0xFFE0, 0xFFF0, 0x0001, 0x0010, 0x001E, 0x002A, 
+	0x0035, 0x003E, 0x0045, 0x0049, 0x004B, 0x0049, 0x0045, 0x003E, 0x0035, 
+	0x002A, 0x001E, 0x0010, 0x0001, 0xFFF0, 0xFFE0, 0xFFD0, 0xFFC0, 0xFFB0, 
+	0xFFA1, 0xFF93, 0xFF87, 0xFF7C, 0xFF73, 0xFF6C, 0xFF68, 0xAB83, 0xAB7D, 
+	0xAB6D, 0xAB53, 0xAB31, 0xAB08, 0xAAD9, 0xAAA5, 0xAA6D, 0xAA33, 0xA9F6, 
+	0xA9B9, 0xA97D, 0xA942, 0xA90A, 0xA8D6, 0xA8A7, 0xA87E, 0xA85C, 0xA843, 
+	0xA833, 0xA82D, 0xA833, 0xA843, 0xA85C, 0xA87E, 0xA8A7, 0xA8D6, 0xA90A, 
+	0xA942, 0xA97D, 0xA9B9, 0xA9F6, 0xAA33, 0xAA6D, 0xAAA5, 0xAAD9, 0xAB08, 
+	0xAB31, 0xAB53, 0xAB6D, 0xAB7D, 
+	},{ 
+	0x0028, 0x0000, 0x001F, 0x0028, 0x0001, 0x0047, 0x0001, 0x0048, 0x0001, 
+	0x0049, 0x0001, 0x004A, 0x0001, 0x004B, 0x0001, 0x004C, 0x0001, 0x004D, 
+	0x002A, 0x004E, 0x002A, 0x0078, 0x002A, 0x00A2, 0x002A, 0x00CC, 0x002A, 
+	0x00F6, 0x002A, 0x0120, 0x0001, 0x014A, 0x0001, 0x014B, 0x0001, 0x014C, 
+	0x002A, 0x014D, 0x002A, 0x0177, 0x002A, 0x01A1, 0x0027, 0x01CB, 0x0001, 
+	0x01F2, 0x002A, 0x01F3, 0x0001, 0x021D, 0x0001, 0x021E, 0x0001, 0x021F, 
+	0x0001, 0x0220, 0x0001, 0x0221, 0x0001, 0x0222, 0x002A, 0x0223, 0x002A, 
+	0x024D, 0x002A, 0x0277, 0x0001, 0x02A1, 0x0028, 0x02A2, 0x002A, 0x02CA, 
+	0x002A, 0x02F4, 0x002A, 0x031E, 0x002A, 0x0348, 0x0001, 0x0372, 0x0001, 
+	0x0373, 0x0001, 0x0374, 0x0001, 0x0375, 0x0001, 0x0376, 0x0001, 0x0377, 
+	0x002A, 0x0378, 0x002A, 0x03A2, 0x002A, 0x03CC, 0x002A, 0x03F6, 0x002A, 
+	0x0420, 0x002A, 0x044A, 0x0001, 0x0474, 0x0001, 0x0475, 0x0001, 0x0476, 
+	0x002A, 0x0477, 0x002A, 0x04A1, 0x002A, 0x04CB, 0x0027, 0x04F5, 0x000D, 
+	0x051C, 0x002A, 0x0529, 0x002A, 0x0553, 0x002A, 0x057D, 0x002A, 0x05A7, 
+});
+
+WARIO_ANIM_CS_MENU = "wario_anim_cs_menu"
+smlua_anim_util_register_animation(WARIO_ANIM_CS_MENU,
+	0,
+	0,
+	0,
+	0,
+	41,
+	{ 
+	0x0000, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B2, 0x00B1, 0x00B1, 0x00B0, 
+	0x00B0, 0x00AF, 0x00AE, 0x00AE, 0x00AD, 0x00AD, 0x00AC, 0x00AB, 0x00AB, 
+	0x00AB, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AA, 0x00AB, 
+	0x00AB, 0x00AB, 0x00AC, 0x00AD, 0x00AD, 0x00AE, 0x00AE, 0x00AF, 0x00B0, 
+	0x00B0, 0x00B1, 0x00B1, 0x00B2, 0x0000, 0x0000, 0x3FFF, 0x0000, 0x5905, 
+	0xFF7B, 0x3FA3, 0xC1C1, 0xC1C1, 0xC1C1, 0xC1C2, 0xC1C2, 0xC1C3, 0xC1C4, 
+	0xC1C5, 0xC1C7, 0xC1C8, 0xC1C9, 0xC1CB, 0xC1CC, 0xC1CD, 0xC1CE, 0xC1D0, 
+	0xC1D1, 0xC1D1, 0xC1D2, 0xC1D3, 0xC1D3, 0xC1D3, 0xC1D3, 0xC1D3, 0xC1D2, 
+	0xC1D1, 0xC1D1, 0xC1D0, 0xC1CE, 0xC1CD, 0xC1CC, 0xC1CB, 0xC1C9, 0xC1C8, 
+	0xC1C7, 0xC1C5, 0xC1C4, 0xC1C3, 0xC1C2, 0xC1C2, 0xC1C1, 0xFF11, 0xFF00, 
+	0xFECC, 0xFE7A, 0xFE0E, 0xFD8B, 0xFCF5, 0xFC4E, 0xFB9B, 0xFAE0, 0xFA1F, 
+	0xF95C, 0xF89B, 0xF7E0, 0xF72D, 0xF686, 0xF5F0, 0xF56D, 0xF501, 0xF4AF, 
+	0xF47B, 0xF469, 0xF47B, 0xF4AF, 0xF501, 0xF56D, 0xF5F0, 0xF686, 0xF72D, 
+	0xF7E0, 0xF89B, 0xF95C, 0xFA1F, 0xFAE0, 0xFB9B, 0xFC4E, 0xFCF5, 0xFD8B, 
+	0xFE0E, 0xFE7A, 0xFECC, 0xFF00, 0xF9D9, 0xF9D8, 0xF9D6, 0xF9D2, 0xF9CE, 
+	0xF9C8, 0xF9C1, 0xF9BA, 0xF9B2, 0xF9A9, 0xF9A1, 0xF998, 0xF990, 0xF987, 
+	0xF97F, 0xF978, 0xF971, 0xF96B, 0xF967, 0xF963, 0xF961, 0xF960, 0xF961, 
+	0xF963, 0xF967, 0xF96B, 0xF971, 0xF978, 0xF97F, 0xF987, 0xF990, 0xF998, 
+	0xF9A1, 0xF9A9, 0xF9B2, 0xF9BA, 0xF9C1, 0xF9C8, 0xF9CE, 0xF9D2, 0xF9D6, 
+	0xF9D8, 0x0A3A, 0x0A39, 0x0A37, 0x0A33, 0x0A2F, 0x0A29, 0x0A23, 0x0A1C, 
+	0x0A14, 0x0A0C, 0x0A04, 0x09FC, 0x09F4, 0x09EC, 0x09E5, 0x09DE, 0x09D7, 
+	0x09D2, 0x09CD, 0x09CA, 0x09C8, 0x09C7, 0x09C8, 0x09CA, 0x09CD, 0x09D2, 
+	0x09D7, 0x09DE, 0x09E5, 0x09EC, 0x09F4, 0x09FC, 0x0A04, 0x0A0C, 0x0A14, 
+	0x0A1C, 0x0A23, 0x0A29, 0x0A2F, 0x0A33, 0x0A37, 0x0A39, 0xFF75, 0xFF6B, 
+	0xFF4C, 0xFF1C, 0xFEDC, 0xFE8E, 0xFE35, 0xFDD2, 0xFD68, 0xFCF9, 0xFC87, 
+	0xFC14, 0xFBA1, 0xFB32, 0xFAC8, 0xFA66, 0xFA0D, 0xF9BF, 0xF97F, 0xF94F, 
+	0xF930, 0xF925, 0xF930, 0xF94F, 0xF97F, 0xF9BF, 0xFA0D, 0xFA66, 0xFAC8, 
+	0xFB32, 0xFBA1, 0xFC14, 0xFC87, 0xFCF9, 0xFD68, 0xFDD2, 0xFE35, 0xFE8E, 
+	0xFEDC, 0xFF1C, 0xFF4C, 0xFF6B, 0xFDB4, 0xFDC7, 0xFDFC, 0xFE51, 0xFEC2, 
+	0xFF4B, 0xFFE8, 0x0096, 0x0151, 0x0214, 0x02DE, 0x03A9, 0x0472, 0x0535, 
+	0x05F0, 0x069D, 0x073A, 0x07C3, 0x0834, 0x0889, 0x08BF, 0x08D1, 0x08BF, 
+	0x0889, 0x0834, 0x07C3, 0x073A, 0x069D, 0x05F0, 0x0535, 0x0472, 0x03A9, 
+	0x02DE, 0x0214, 0x0151, 0x0096, 0xFFE8, 0xFF4B, 0xFEC2, 0xFE51, 0xFDFC, 
+	0xFDC7, 0xFFFE, 0x0001, 0xC170, 0xD482, 0xD490, 0xD4B9, 0xD4FD, 0xD55A, 
+	0xD5CF, 0xD65A, 0xD6FB, 0xD7B1, 0xD879, 0xD954, 0xDA40, 0xDB3B, 0xDC45, 
+	0xDD5D, 0xDE80, 0xDFAF, 0xE0E8, 0xE22A, 0xE304, 0xE22A, 0xE400, 0xE22A, 
+	0xE304, 0xE22A, 0xE0E8, 0xDFAF, 0xDE80, 0xDD5D, 0xDC45, 0xDB3B, 0xDA40, 
+	0xD954, 0xD879, 0xD7B1, 0xD6FB, 0xD65A, 0xD5CF, 0xD55A, 0xD4FD, 0xD4B9, 
+	0xD490, 0xD13B, 0xD131, 0xD116, 0xD0EB, 0xD0B1, 0xD06B, 0xD01A, 0xCFBF, 
+	0xCF5C, 0xCEF4, 0xCE87, 0xCE18, 0xCDA7, 0xCD37, 0xCCCA, 0xCC61, 0xCBFD, 
+	0xCBA1, 0xCB4E, 0xCB1C, 0xCB4E, 0xCAE1, 0xCB4E, 0xCB1C, 0xCB4E, 0xCBA1, 
+	0xCBFD, 0xCC61, 0xCCCA, 0xCD38, 0xCDA7, 0xCE18, 0xCE87, 0xCEF4, 0xCF5C, 
+	0xCFBF, 0xD01A, 0xD06B, 0xD0B1, 0xD0EB, 0xD116, 0xD131, 0xB677, 0xB677, 
+	0xB674, 0xB66E, 0xB662, 0xB64F, 0xB632, 0xB609, 0xB5D3, 0xB58D, 0xB537, 
+	0xB4CD, 0xB44D, 0xB3B7, 0xB308, 0xB23E, 0xB157, 0xB051, 0xAF2B, 0xAE3C, 
+	0xAF2B, 0xAD37, 0xAF2B, 0xAE3C, 0xAF2B, 0xB051, 0xB157, 0xB23E, 0xB308, 
+	0xB3B7, 0xB44D, 0xB4CD, 0xB537, 0xB58D, 0xB5D3, 0xB609, 0xB632, 0xB64F, 
+	0xB662, 0xB66E, 0xB674, 0xB677, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xCFE0, 0xCFC7, 0xCF7F, 
+	0xCF0E, 0xCE79, 0xCDC4, 0xCCF4, 0xCC10, 0xCB1B, 0xCA1A, 0xC914, 0xC80C, 
+	0xC709, 0xC60E, 0xC521, 0xC447, 0xC385, 0xC2E0, 0xC25D, 0xC219, 0xC25D, 
+	0xC1BE, 0xC25D, 0xC219, 0xC25D, 0xC2E0, 0xC385, 0xC447, 0xC521, 0xC60E, 
+	0xC709, 0xC80C, 0xC914, 0xCA1A, 0xCB1B, 0xCC10, 0xCCF4, 0xCDC4, 0xCE79, 
+	0xCF0E, 0xCF7F, 0xCFC7, 0xBDF0, 0xF19F, 0xE2DE, 0xFFFE, 0x0001, 0xC170, 
+	0x3C6D, 0x3B58, 0x3844, 0x3371, 0x2D1F, 0x258E, 0x1CFD, 0x13AC, 0x09DC, 
+	0xFFCA, 0x75BB, 0x6BEA, 0x629A, 0x5A09, 0x5277, 0x4C25, 0x4752, 0x443E, 
+	0x4329, 0x437C, 0x4329, 0x431C, 0x4329, 0x437C, 0x4329, 0x443E, 0x4752, 
+	0x4C25, 0x5277, 0x5A09, 0x629A, 0x6BEA, 0x75BB, 0xFFCA, 0x09DC, 0x13AC, 
+	0x1CFD, 0x258E, 0x2D1F, 0x3371, 0x3844, 0x3B58, 0x3B00, 0x3B06, 0x3B15, 
+	0x3B2E, 0x3B4E, 0x3B75, 0x3BA1, 0x3BD0, 0x3C02, 0x3C36, 0x4396, 0x4364, 
+	0x4335, 0x4309, 0x42E2, 0x42C2, 0x42AA, 0x429A, 0x4294, 0x42F3, 0x4294, 
+	0x434E, 0x4294, 0x42F3, 0x4294, 0x429A, 0x42AA, 0x42C2, 0x42E2, 0x4309, 
+	0x4335, 0x4364, 0x4396, 0x3C36, 0x3C02, 0x3BD0, 0x3BA1, 0x3B75, 0x3B4E, 
+	0x3B2E, 0x3B15, 0x3B06, 0xC81A, 0xC715, 0xC42F, 0xBFA4, 0xB9B1, 0xB290, 
+	0xAA7F, 0xA1BA, 0x987C, 0x8F02, 0x0588, 0xFC49, 0xF384, 0xEB73, 0xE452, 
+	0xDE5E, 0xD9D3, 0xD6EE, 0xD5E9, 0xD62F, 0xD5E9, 0xD5CF, 0xD5E9, 0xD62F, 
+	0xD5E9, 0xD6EE, 0xD9D3, 0xDE5E, 0xE452, 0xEB73, 0xF384, 0xFC49, 0x0588, 
+	0x8F02, 0x987C, 0xA1BA, 0xAA7F, 0xB290, 0xB9B1, 0xBFA4, 0xC42F, 0xC715, 
+	0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xD5E1, 0xD5C8, 
+	0xD581, 0xD510, 0xD47A, 0xD3C5, 0xD2F6, 0xD211, 0xD11C, 0xD01C, 0xCF15, 
+	0xCE0E, 0xCD0A, 0xCC0F, 0xCB22, 0xCA48, 0xC986, 0xC8E1, 0xC85E, 0xC81A, 
+	0xC85E, 0xC7BF, 0xC85E, 0xC81A, 0xC85E, 0xC8E1, 0xC986, 0xCA48, 0xCB22, 
+	0xCC0F, 0xCD0A, 0xCE0E, 0xCF15, 0xD01C, 0xD11C, 0xD211, 0xD2F6, 0xD3C5, 
+	0xD47A, 0xD510, 0xD581, 0xD5C8, 0x4330, 0x04EE, 0xE37A, 0x0000, 0xFFFF, 
+	0xBF5E, 0x1C79, 0x1C7A, 0x1C7B, 0x1C7E, 0x1C82, 0x1C86, 0x1C8B, 0x1C91, 
+	0x1C97, 0x1C9D, 0x1CA4, 0x1CAB, 0x1CB1, 0x1CB7, 0x1CBE, 0x1CC3, 0x1CC8, 
+	0x1CCD, 0x1CD0, 0x1CD3, 0x1CD5, 0x1CD6, 0x1CD5, 0x1CD3, 0x1CD0, 0x1CCD, 
+	0x1CC8, 0x1CC3, 0x1CBE, 0x1CB7, 0x1CB1, 0x1CAB, 0x1CA4, 0x1C9D, 0x1C97, 
+	0x1C91, 0x1C8B, 0x1C86, 0x1C82, 0x1C7E, 0x1C7B, 0x1C7A, 0xF46A, 0xF46C, 
+	0xF471, 0xF47A, 0xF485, 0xF493, 0xF4A2, 0xF4B4, 0xF4C6, 0xF4DA, 0xF4EE, 
+	0xF502, 0xF516, 0xF529, 0xF53C, 0xF54D, 0xF55D, 0xF56A, 0xF575, 0xF57E, 
+	0xF583, 0xF585, 0xF583, 0xF57E, 0xF575, 0xF56A, 0xF55D, 0xF54D, 0xF53C, 
+	0xF529, 0xF516, 0xF502, 0xF4EE, 0xF4DA, 0xF4C6, 0xF4B4, 0xF4A2, 0xF493, 
+	0xF485, 0xF47A, 0xF471, 0xF46C, 0xCBF7, 0xCBF5, 0xCBEE, 0xCBE4, 0xCBD6, 
+	0xCBC6, 0xCBB3, 0xCB9E, 0xCB87, 0xCB6F, 0xCB57, 0xCB3E, 0xCB25, 0xCB0E, 
+	0xCAF7, 0xCAE2, 0xCACF, 0xCABE, 0xCAB0, 0xCAA6, 0xCAA0, 0xCA9D, 0xCAA0, 
+	0xCAA6, 0xCAB0, 0xCABE, 0xCACF, 0xCAE2, 0xCAF7, 0xCB0E, 0xCB25, 0xCB3E, 
+	0xCB57, 0xCB6F, 0xCB87, 0xCB9E, 0xCBB3, 0xCBC6, 0xCBD6, 0xCBE4, 0xCBEE, 
+	0xCBF5, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x328E, 0x32A9, 0x32F4, 
+	0x336C, 0x340B, 0x34CB, 0x35A8, 0x369C, 0x37A2, 0x38B5, 0x39D0, 0x3AEE, 
+	0x3C09, 0x3D1C, 0x3E23, 0x3F17, 0x3FF4, 0x40B4, 0x4153, 0x41CA, 0x4216, 
+	0x4230, 0x4216, 0x41CA, 0x4153, 0x40B4, 0x3FF4, 0x3F17, 0x3E23, 0x3D1C, 
+	0x3C09, 0x3AEE, 0x39D0, 0x38B5, 0x37A2, 0x369C, 0x35A8, 0x34CB, 0x340B, 
+	0x336C, 0x32F4, 0x32A9, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 
+	0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0xAD50, 
+	0xAD40, 0xAD12, 0xACCA, 0xAC69, 0xABF4, 0xAB6E, 0xAADA, 0xAA3A, 0xA993, 
+	0xA8E7, 0xA839, 0xA78D, 0xA6E6, 0xA647, 0xA5B2, 0xA52C, 0xA4B7, 0xA457, 
+	0xA40E, 0xA3E0, 0xA3D0, 0xA3E0, 0xA40E, 0xA457, 0xA4B7, 0xA52C, 0xA5B2, 
+	0xA647, 0xA6E6, 0xA78D, 0xA839, 0xA8E7, 0xA993, 0xAA3A, 0xAADA, 0xAB6E, 
+	0xABF4, 0xAC69, 0xACCA, 0xAD12, 0xAD40, 0x0000, 0xFFFF, 0xBF5E, 0x22E0, 
+	0x22DB, 0x22CB, 0x22B1, 0x2290, 0x2267, 0x2238, 0x2204, 0x21CD, 0x2192, 
+	0x2156, 0x211A, 0x20DE, 0x20A4, 0x206C, 0x2038, 0x2009, 0x1FE1, 0x1FBF, 
+	0x1FA6, 0x1F96, 0x1F90, 0x1F96, 0x1FA6, 0x1FBF, 0x1FE1, 0x2009, 0x2038, 
+	0x206C, 0x20A4, 0x20DE, 0x211A, 0x2156, 0x2192, 0x21CD, 0x2204, 0x2238, 
+	0x2267, 0x2290, 0x22B1, 0x22CB, 0x22DB, 0x1496, 0x149F, 0x14BA, 0x14E4, 
+	0x151B, 0x155E, 0x15AB, 0x1600, 0x165C, 0x16BC, 0x171F, 0x1783, 0x17E5, 
+	0x1845, 0x18A1, 0x18F6, 0x1943, 0x1986, 0x19BE, 0x19E8, 0x1A02, 0x1A0B, 
+	0x1A02, 0x19E8, 0x19BE, 0x1986, 0x1943, 0x18F6, 0x18A1, 0x1845, 0x17E5, 
+	0x1783, 0x171F, 0x16BC, 0x165C, 0x1600, 0x15AB, 0x155E, 0x151B, 0x14E4, 
+	0x14BA, 0x149F, 0xAFCA, 0xAFBF, 0xAFA2, 0xAF73, 0xAF35, 0xAEEA, 0xAE94, 
+	0xAE35, 0xADCF, 0xAD63, 0xACF5, 0xAC85, 0xAC17, 0xABAC, 0xAB45, 0xAAE6, 
+	0xAA90, 0xAA45, 0xAA07, 0xA9D8, 0xA9BB, 0xA9B1, 0xA9BB, 0xA9D8, 0xAA07, 
+	0xAA45, 0xAA90, 0xAAE6, 0xAB45, 0xABAC, 0xAC17, 0xAC85, 0xACF5, 0xAD63, 
+	0xADCF, 0xAE35, 0xAE94, 0xAEEA, 0xAF35, 0xAF73, 0xAFA2, 0xAFBF, 0xFFFF, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 0xFFFF, 
+	0x0000, 0xFFFF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0x0000, 0x0000, 0x0000, 0xFFFF, 0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0x0000, 
+	0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0x0000, 
+	0x0000, 0xFFFF, 0xFFFF, 0x0000, 0x0000, 0xFFFF, 0x0000, 0x1E4A, 0x1E63, 
+	0x1EAB, 0x1F1D, 0x1FB4, 0x206A, 0x213D, 0x2225, 0x231E, 0x2424, 0x2531, 
+	0x2641, 0x274E, 0x2854, 0x294E, 0x2A36, 0x2B08, 0x2BBF, 0x2C56, 0x2CC7, 
+	0x2D0F, 0x2D28, 0x2D0F, 0x2CC7, 0x2C56, 0x2BBF, 0x2B08, 0x2A36, 0x294E, 
+	0x2854, 0x274E, 0x2641, 0x2531, 0x2424, 0x231E, 0x2225, 0x213D, 0x206A, 
+	0x1FB4, 0x1F1D, 0x1EAB, 0x1E63, 0xFFFF, 0x0000, 0x0001, 0x0002, 0x0004, 
+	0x0005, 0x0008, 0x000A, 0x000C, 0x000F, 0x0012, 0x0014, 0x0017, 0x001A, 
+	0x001C, 0x001F, 0x0021, 0x0022, 0x0024, 0x0025, 0x0026, 0x0026, 0x0026, 
+	0x0025, 0x0024, 0x0022, 0x0021, 0x001F, 0x001C, 0x001A, 0x0017, 0x0014, 
+	0x0012, 0x000F, 0x000C, 0x000A, 0x0008, 0x0005, 0x0004, 0x0002, 0x0001, 
+	0x0000, 0xFF2F, 0xFF2F, 0xFF2F, 0xFF2F, 0xFF2F, 0xFF30, 0xFF30, 0xFF30, 
+	0xFF30, 0xFF30, 0xFF31, 0xFF31, 0xFF31, 0xFF31, 0xFF32, 0xFF32, 0xFF32, 
+	0xFF32, 0xFF32, 0xFF32, 0xFF33, 0xFF33, 0xFF32, 0xFF32, 0xFF32, 0xFF32, 
+	0xFF32, 0xFF32, 0xFF32, 0xFF31, 0xFF31, 0xFF31, 0xFF31, 0xFF30, 0xFF30, 
+	0xFF30, 0xFF30, 0xFF30, 0xFF2F, 0xC9D7, 0xC9CB, 0xC9A6, 0xC96D, 0xC921, 
+	0xC8C4, 0xC85A, 0xC7E5, 0xC767, 0xC6E3, 0xC65C, 0xC5D2, 0xC54B, 0xC4C7, 
+	0xC449, 0xC3D4, 0xC36A, 0xC30D, 0xC2C1, 0xC288, 0xC263, 0xC257, 0xC263, 
+	0xC288, 0xC2C1, 0xC30D, 0xC36A, 0xC3D4, 0xC449, 0xC4C7, 0xC54B, 0xC5D2, 
+	0xC65C, 0xC6E3, 0xC767, 0xC7E5, 0xC85A, 0xC8C4, 0xC921, 0xC96D, 0xC9A6, 
+	0xC9CB, 
+	},{ 
+	0x0001, 0x0000, 0x0027, 0x0001, 0x0001, 0x0028, 0x0001, 0x0029, 0x0001, 
+	0x002A, 0x0001, 0x002B, 0x0001, 0x002C, 0x0001, 0x002D, 0x0001, 0x002E, 
+	0x0029, 0x002F, 0x002A, 0x0058, 0x002A, 0x0082, 0x002A, 0x00AC, 0x002A, 
+	0x00D6, 0x002A, 0x0100, 0x0001, 0x012A, 0x0001, 0x012B, 0x0001, 0x012C, 
+	0x002A, 0x012D, 0x002A, 0x0157, 0x002A, 0x0181, 0x002A, 0x01AB, 0x000E, 
+	0x01D5, 0x002A, 0x01E3, 0x0001, 0x020D, 0x0001, 0x020E, 0x0001, 0x020F, 
+	0x0001, 0x0210, 0x0001, 0x0211, 0x0001, 0x0212, 0x002A, 0x0213, 0x002A, 
+	0x023D, 0x002A, 0x0267, 0x0001, 0x0291, 0x002A, 0x0292, 0x002A, 0x02BC, 
+	0x0001, 0x02E6, 0x0001, 0x02E7, 0x0001, 0x02E8, 0x0001, 0x02E9, 0x0001, 
+	0x02EA, 0x0001, 0x02EB, 0x002A, 0x02EC, 0x002A, 0x0316, 0x002A, 0x0340, 
+	0x0001, 0x036A, 0x0016, 0x036B, 0x002A, 0x0381, 0x0014, 0x03AB, 0x0015, 
+	0x03BF, 0x002A, 0x03D4, 0x0001, 0x03FE, 0x0001, 0x03FF, 0x0001, 0x0400, 
+	0x002A, 0x0401, 0x002A, 0x042B, 0x002A, 0x0455, 0x0029, 0x047F, 0x0015, 
+	0x04A8, 0x002A, 0x04BD, 0x002A, 0x04E7, 0x0027, 0x0511, 0x002A, 0x0538, 
+});
@@ -0,0 +1,2922 @@
+sDialogsEE = false
+
+----------
+-- sm74 --
+----------
+
+local function dialog_swap_sm74()
+if not sDialogsEE then return end
+smlua_text_utils_dialog_replace(DIALOG_000,1,6,30,200, "Welcome to a new world!")
+
+smlua_text_utils_dialog_replace(DIALOG_001,1,4,95,200, "Help me...\
+I'm supposed to be a pink\
+Bob-Omb but a Kamek \
+transformed me :(\
+\
+Well...\
+\
+What I am supposed to tell\
+you - this is the big\
+observation tower.\
+Some guys said only birds\
+could reach the top.\
+\
+...or other flying \
+objects. So if you have \
+problems with some of the \
+missions search for the \
+switch palaces. They may \
+help you.")
+
+smlua_text_utils_dialog_replace(DIALOG_002,1,4,95,200, "You can look under the\
+flowers in ego-persp. \
+([C]^)\
+\
+Hmm... but why?")
+
+smlua_text_utils_dialog_replace(DIALOG_003,1,5,95,200, "Welcome to the\
+'dumbest plumber on\
+earth'-show.\
+You only need a key to\
+see it.")
+
+smlua_text_utils_dialog_replace(DIALOG_004,1,3,95,200, "Welcome to the\
+Luminium-Sphere,\
+the mechanical temple\
+of Light.\
+\
+Enjoy the view and try \
+not to fall off.")
+
+smlua_text_utils_dialog_replace(DIALOG_005,1,3,30,200, "Hey, Mario! Is it true\
+that you beat the Big\
+Bob-omb? Cool!\
+You must be strong. And\
+pretty fast. So, how fast\
+are you, anyway?\
+Fast enough to beat me...\
+Koopa the Quick? I don't\
+think so. Just try me.\
+How about a race to the\
+mountaintop, where the\
+Big Bob-omb was?\
+Whaddya say? When I say\
+『Go,』 let the race begin!\
+\
+Ready....\
+\
+//Go!////Don't Go")
+
+smlua_text_utils_dialog_replace(DIALOG_006,1,3,30,200, "Warning!\
+A lot of skill is needed\
+to beat this level.\
+\
+Here are two tips:\
+\
+1. When you see a grey\
+wall try using the\
+wallkick.\
+2. Triple jumps may help\
+you pass some of the\
+green slopes.\
+\
+Good luck!\
+        -Koopa")
+
+smlua_text_utils_dialog_replace(DIALOG_007,1,5,30,200, "The star is so close!\
+\
+Can you do the jump?")
+
+smlua_text_utils_dialog_replace(DIALOG_008,1,4,30,200, "Check out the view!\
+([C]^)")
+
+smlua_text_utils_dialog_replace(DIALOG_009,1,5,30,200, "Heyho, ma boy!\
+I checked out some videos\
+on Youtube and now,\
+I know everything about\
+you!\
+You cheated! Very often!\
+\
+And now I want revenge!\
+Another race!\
+And this time I will be\
+the one who cheats!\
+\
+//Go//// Don't Go")
+
+smlua_text_utils_dialog_replace(DIALOG_010,1,4,30,200, "You activated the red\
+switch! Now you can fly\
+through the sky.\
+Did you see the red !-Box\
+in the Dice-Fortress\
+course?\
+\
+\
+Would you like to Save?\
+\
+//Yes////No")
+
+smlua_text_utils_dialog_replace(DIALOG_011,1,4,30,200, "You activated the metal\
+cap. It makes Mario so\
+heavy that he can walk\
+underwater.\
+Have you seen a place\
+where this might be\
+useful?\
+\
+Would you like to Save?\
+\
+//Yes////No")
+
+smlua_text_utils_dialog_replace(DIALOG_012,1,4,30,200, "The Vanish Cap is\
+activated. Now turn\
+yourself into a Boo and\
+scare other people.\
+\
+\
+\
+\
+Would you like to Save?\
+\
+//Yes////No")
+
+smlua_text_utils_dialog_replace(DIALOG_013,1,5,30,200, "You've collected 100\
+coins! Mario gains a star\
+from Toad.\
+Do you want to Save?\
+//Yes////No")
+
+smlua_text_utils_dialog_replace(DIALOG_014,1,4,30,200, "WOW! A star!\
+I've never seen anything\
+that UNspecial before.\
+Do you still have the\
+urge to save?\
+\
+//You Bet//Not Now")
+
+smlua_text_utils_dialog_replace(DIALOG_015,1,4,30,200, "It is recommended to\
+use Mario's perspective\
+and zoom in with [C]^ if\
+you enter a house.")
+
+smlua_text_utils_dialog_replace(DIALOG_016,1,3,30,200, "This looks like a nice\
+place to start jumping\
+over some roofs.\
+Maybe you get to an\
+interesting place?")
+
+smlua_text_utils_dialog_replace(DIALOG_017,1,4,30,200, "Hey, I remember you!\
+You are this evil person\
+who defeated me last\
+time!\
+\
+But now you stand no\
+chance!\
+Look how tiny this arena\
+is!\
+Mwahahaha!")
+
+smlua_text_utils_dialog_replace(DIALOG_018,1,4,30,200, "These flowers aren't\
+normal.\
+\
+They are hiding...\
+treasures.")
+
+smlua_text_utils_dialog_replace(DIALOG_019,1,2,30,200, "Mysterious hidden Object\
+5 of 5\
+\
+This object displays\
+a lot of creativity\
+and innovation.\
+\
+Legends are telling that\
+this object has the\
+power to split up\
+groups of people \
+who once were the same.\
+\
+Those split-up groups\
+either hate or love\
+what has happened.\
+\
+Was it a good idea to\
+create this magical\
+object?\
+\
+We'll see if the\
+future has more of these\
+mysterious objects to\
+offer.\
+\
+I for myself hope so.")
+
+smlua_text_utils_dialog_replace(DIALOG_020,1,6,95,150, "Dear Mario:\
+Something is wrong with\
+the paintings in my castle.\
+Please have a look at them.\
+Yours truly\
+-the floating princess-")
+
+smlua_text_utils_dialog_replace(DIALOG_021,1,5,95,200, "Mwahaha! \
+I changed all the\
+levels so you won't be\
+able to rescue Peach!\
+...again.")
+
+smlua_text_utils_dialog_replace(DIALOG_022,1,2,95,200, "You can't open this\
+door yet.")
+
+smlua_text_utils_dialog_replace(DIALOG_023,1,3,95,200, "C'mon! Haven't you\
+played this game before?")
+
+smlua_text_utils_dialog_replace(DIALOG_024,1,5,95,200, "Are you too dumb to\
+find the entrances to\
+the first world?\
+That's sad.")
+
+smlua_text_utils_dialog_replace(DIALOG_025,1,4,95,200, "Are you blind?\
+Don't you see a 3\
+on the door?\
+And how many stars do\
+you have? NOT THREE!")
+
+smlua_text_utils_dialog_replace(DIALOG_026,1,4,95,200, "You can't even find\
+8 stars? are you\
+serious?")
+
+smlua_text_utils_dialog_replace(DIALOG_027,1,4,95,200, "You need 100 stars to\
+open this door.\
+...but since you are\
+so bad at this game...\
+you will only need 30.")
+
+smlua_text_utils_dialog_replace(DIALOG_028,1,4,95,200, "50 stars. That's all\
+I'm asking for.\
+\
+You could have 80 by now\
+but NO, you want to talk\
+to doors!\
+How stupid!")
+
+smlua_text_utils_dialog_replace(DIALOG_029,1,5,95,200, "70 stars required.\
+\
+Sort of.\
+If you don't have the\
+time to collect 70 stars,\
+go ahead and cheat.")
+
+smlua_text_utils_dialog_replace(DIALOG_030,1,6,30,200, "Hey, Mario! Nice to\
+see you again!\
+\
+I was trapped in here\
+since we last met!\
+\
+Wow, you really got\
+so many stars! Amazing!\
+You really are a \
+fat pl...\
+hero!\
+\
+I'm sure it wasn't\
+easy to get this far.\
+Or did you cheat? Be\
+honest.\
+\
+Well, now you may think\
+you're almost done but \
+if you are okay with it,\
+I even have some more \
+tasks for you to do.\
+\
+I've read somewhere in\
+the internet that there\
+are 5 well hidden objects\
+in this game. All of them\
+are in this temple.\
+One per star door.\
+Can you find them all?\
+\
+And if that's not enough,\
+check out the\
+'Medal-Challenges' that\
+came with this game.")
+
+smlua_text_utils_dialog_replace(DIALOG_031,1,5,30,200, "HOW?! You cheated again!\
+I know it!\
+\
+Take the star...")
+
+smlua_text_utils_dialog_replace(DIALOG_032,1,5,30,200, "32")
+
+smlua_text_utils_dialog_replace(DIALOG_033,1,6,30,200, "You just came out of the\
+sewer system!\
+Eww...\
+You smell bad.\
+Anyways, this is the game.\
+Well, partly.\
+This is the first DEMO.\
+So everything past the\
+entrance hall isn't\
+changed yet.\
+\
+HACK BY LUGMILLORD")
+
+smlua_text_utils_dialog_replace(DIALOG_034,1,6,30,200, "Good Morning, my name is\
+'the annoying Lakitu'\
+and I'm here to interrupt\
+you from playing this\
+game.")
+
+smlua_text_utils_dialog_replace(DIALOG_035,1,5,30,200, "Do you want to swim\
+down there?\
+Use Lakitu's perspective\
+and zoom out with [C]|.")
+
+smlua_text_utils_dialog_replace(DIALOG_036,1,5,30,200, "Hey, you!\
+Yes, YOU!\
+\
+Welcome to the\
+Sunny Beach. Looks kinda\
+peaceful, doesn't it?\
+And I think this level\
+could be a bit too easy.\
+\
+So here's the deal:\
+I'm not going to give\
+you any hints where the\
+stars are.\
+\
+There are almost exactly\
+100 coins in this level.\
+So don't waste any.")
+
+smlua_text_utils_dialog_replace(DIALOG_037,1,2,30,200, "37")
+
+smlua_text_utils_dialog_replace(DIALOG_038,1,3,95,200, "A star explodes to\
+open the locked door.\
+Don't ask why.")
+
+smlua_text_utils_dialog_replace(DIALOG_039,1,4,30,200, "Mario can grab onto some\
+of the roofs.\
+This may help when you\
+try to get to the top\
+of some buildings.")
+
+smlua_text_utils_dialog_replace(DIALOG_040,1,3,30,200, "WARNING!!\
+Once you go down there\
+there's no way back.\
+(If you are looking\
+for coins - there aren't\
+any down there)")
+
+smlua_text_utils_dialog_replace(DIALOG_041,1,3,30,200, "HARHARHAR!!\
+I WIN!\
+Finally!\
+After more than a decade!\
+No star for you!")
+
+smlua_text_utils_dialog_replace(DIALOG_042,1,4,30,200, "Land:\
+Mario's perspective\
+(zoomed out)\
+\
+Water:\
+Lakitu's perspective")
+
+smlua_text_utils_dialog_replace(DIALOG_043,1,5,30,200, "Cameras and caves don't\
+like each other. I guess\
+it's because they start\
+with the same two letters.\
+\
+Well, in the worst case,\
+when the camera really\
+is stupid, you can\
+change its position\
+manually in the ego-\
+perspective.")
+
+smlua_text_utils_dialog_replace(DIALOG_044,1,5,95,200, "44")
+
+smlua_text_utils_dialog_replace(DIALOG_045,1,6,95,200, "45")
+
+smlua_text_utils_dialog_replace(DIALOG_046,1,5,30,200, "Can't reach a place\
+because it's too high?\
+Try using a combination\
+of a triple- and a wall-\
+jump.\
+Or maybe you find a\
+purple switch?")
+
+smlua_text_utils_dialog_replace(DIALOG_047,1,2,95,200, "Hey there! I'll open up \
+the cannon for you.")
+
+smlua_text_utils_dialog_replace(DIALOG_048,1,4,30,200, "Mysterious Hidden Object\
+4 of 5\
+\
+This object displays\
+perfection (at least\
+that's what I think).\
+\
+Having friends to help\
+you out is always nice\
+but sometimes there are\
+tasks you need to do\
+on your own.\
+\
+Connect the worlds and\
+show me ya moves.\
+\
+Will we ever see the\
+glory again?\
+\
+This question remains\
+unanswered.")
+
+smlua_text_utils_dialog_replace(DIALOG_049,1,5,30,200, "Remember to zoom in\
+if you have problems with\
+the camera.")
+
+smlua_text_utils_dialog_replace(DIALOG_050,1,4,30,200, "You are more than a \
+decade to late.")
+
+smlua_text_utils_dialog_replace(DIALOG_051,1,6,30,200, "This sign is useless.\
+But you read it anyway.")
+
+smlua_text_utils_dialog_replace(DIALOG_052,1,5,30,200, "I've heard there are\
+more than one star in the\
+side levels.\
+It can be useful to\
+visit them a few times\
+more.")
+
+smlua_text_utils_dialog_replace(DIALOG_053,1,5,30,200, "Hey there, Mario!\
+\
+Tough luck, buddy!\
+Bowser kidnapped Peach\
+again (who cares...)\
+AND\
+he stole even more stars\
+than last time.\
+\
+The reason? He even found\
+the 30 stars that were\
+hidden in the toilet!\
+\
+...what? NO! We are not\
+going to tell you which\
+of the stars have been in \
+the toilet. You collect \
+ALL of them, okay?\
+\
+Oh, and one important\
+thing:\
+Talk to the 5 Info-Toads\
+in this area before \
+heading into the\
+adventure.\
+\
+They'll give you some \
+important advice!\
+\
+Good luck\
+with... well, all\
+        the stuff you do.\
+\
+by the way, hack by\
+LUGMILLORD")
+
+smlua_text_utils_dialog_replace(DIALOG_054,1,5,30,200, "Hi! I'm Info Toad 1.\
+\
+Welcome to SM74\
+\
+Enjoy your stay!")
+
+smlua_text_utils_dialog_replace(DIALOG_055,1,4,30,200, "Hey-ey, Mario, buddy,\
+howzit goin'? Step right\
+up. You look like a fast\
+sleddin' kind of guy.\
+I know speed when I see\
+it, yes siree--I'm the\
+world champion sledder,\
+you know. Whaddya say?\
+How about a race?\
+Ready...\
+\
+//Go//// Don't Go")
+
+smlua_text_utils_dialog_replace(DIALOG_056,1,6,30,200, "Mysterious Hidden Object\
+1 of 5\
+\
+This object displays some\
+sort of rivalry for you.\
+\
+Adventures, Animals and\
+Jigsaw Pieces.\
+\
+Put together to create\
+a masterpiece.\
+\
+This object happens to\
+have a mystery so...\
+mysterious that people\
+still ask themselves\
+questions about it.\
+\
+But the mystery was\
+stopped years ago and\
+got swopped.\
+\
+Now you may use the\
+power of the biggest\
+net imaginable to dig\
+deeper in this hole\
+of the unknown.")
+
+smlua_text_utils_dialog_replace(DIALOG_057,1,4,30,200, "This is it!\
+The final level!\
+The Crystal Palace!\
+\
+...too bad most of the\
+crystals are missing due\
+to some... let's say\
+software problems.\
+\
+Anyways, if you have\
+camera problems, remember\
+to zoom in (Mario p.)!\
+Many people ignore these\
+kind of messages.\
+...fools.")
+
+smlua_text_utils_dialog_replace(DIALOG_058,1,4,30,200, "Twice the amount\
+or else they won't count.")
+
+smlua_text_utils_dialog_replace(DIALOG_059,1,4,30,200, "Hey, you!\
+Listen closely!\
+This is how this level\
+works:\
+As you see, there are\
+three different routes.\
+You can't use the left\
+one cause there's\
+deadly quicksand.\
+Instead, use the right\
+way and use the Koopa\
+shell you find at the end.\
+\
+If you manage to beat\
+both paths, the cannon\
+can be opened and you\
+can take the path in\
+the middle.\
+\
+And don't try to get past\
+it without the cannon.\
+The dark matter will\
+kill you!\
+\
+Good luck wishes\
+...the signpainter.\
+\
+oh, wait, wrong game.")
+
+smlua_text_utils_dialog_replace(DIALOG_060,1,4,30,200, "DUDE, I'm Info-Toad nr.2!\
+\
+It's important to have\
+a look at the signs that\
+are placed all over the\
+country.\
+\
+They can give you some\
+funky advice, you know.\
+\
+And some hidden ones may\
+even tell you how many\
+stars you can find in \
+the smaller levels\
+(cause most of them do\
+now have way more stars\
+than before).")
+
+smlua_text_utils_dialog_replace(DIALOG_061,1,4,30,200, "You are fatter than I\
+remembered...\
+\
+I mean...\
+\
+\
+HI, I'M INFO-TOAD 3!\
+\
+I'm kinda greedy and want\
+a lot of money to buy\
+a car and a house and\
+a spaceship and some\
+galaxies as well.\
+\
+But you know what?\
+I don't have enough coins\
+to buy all this nice\
+stuff.\
+\
+LISTEN TO ME!\
+\
+In the worlds of this\
+game you can find tons\
+of coins. I mean, WOW,\
+so much money!\
+\
+15 of them even have\
+more than 100. And I \
+want those. If you \
+collect 100 coins in \
+one of those levels...\
+...you get a ★!")
+
+smlua_text_utils_dialog_replace(DIALOG_062,1,3,30,200, "Hello! I'm Info-Toad...\
+number... uhh...\
+hmm, I forgot...\
+\
+4? yes, I think 4.\
+\
+Well, anyways...\
+This right here is the\
+entrance to the first\
+course.\
+But you can't get all\
+of its stars yet.\
+You need to find the red\
+cap switch first. I don't\
+know where it is but\
+is is -somewhere-.\
+\
+Oh, and I hope you are\
+still as good at jumping\
+as back in... whenever\
+the original game came\
+out. 1996 or 1997 \
+depending on where you \
+live.\
+\
+But who CARES.\
+\
+If a place is too high\
+for you, try a combination\
+of a triple jump or\
+side somersault and a\
+wall kick.\
+Or get on drugs, harhar.\
+Oh, wait... bad idea.\
+This is a family game\
+after all. DARN!")
+
+smlua_text_utils_dialog_replace(DIALOG_063,1,5,30,200, "I'm the impressive\
+and unbelievable\
+Info-Toad numero 5!\
+\
+Some people don't even\
+recognize it but I'm\
+floating like 50cm over\
+the ground cause I hate\
+being small.\
+\
+Now... what was I\
+supposed to tell you?\
+Hmmm... I don't know.\
+Neither do I care.\
+I'll just entertain you\
+with some funny sentences.\
+\
+Is this okay for you?\
+No? You want info?\
+How about this one:\
+\
+'Press [A] to jump'\
+\
+Awesome, isn't it?\
+Now you know more than\
+ever before.\
+That's not enough?\
+What else could I tell\
+you?\
+\
+'Stop annoying Toads\
+cause one day they will\
+unite, take over the\
+mushroom kingdom and \
+'delete' all plumbers on \
+earth.\
+...except for Luigi.'")
+
+smlua_text_utils_dialog_replace(DIALOG_064,1,5,30,200, "Oh no! Bowser is hacking\
+the game and makes the\
+star door textures \
+glitch out!\
+\
+...oh boy, what a bad\
+excuse.\
+\
+But you have to live\
+with it.")
+
+smlua_text_utils_dialog_replace(DIALOG_065,1,6,30,200, "Wrong game.\
+What are you doing here?")
+
+smlua_text_utils_dialog_replace(DIALOG_066,1,5,30,200, "This roof used be covered\
+with loads of crystals.\
+Like 30 or 40.\
+\
+Oh well, we can't have\
+everything we want, \
+can we?\
+\
+Hmmm... did you know\
+there are many secrets\
+within this game?\
+I've heard there is one\
+in this level but it's\
+very difficult to find.")
+
+smlua_text_utils_dialog_replace(DIALOG_067,1,5,30,200, "Mwahahaha, you again!\
+You may think I'm still\
+easy to defeat but\
+YOU ARE WRONG!!\
+\
+I didn't have the money \
+for some arena manipu-\
+lation software since \
+I already blew everything\
+on 2D-castles but at \
+least these spike balls \
+are higher than before.")
+
+smlua_text_utils_dialog_replace(DIALOG_068,1,5,30,200, "68")
+
+smlua_text_utils_dialog_replace(DIALOG_069,1,6,30,200, "To jump push [A].\
+\
+What? You want useful\
+information?\
+No, not from me.")
+
+smlua_text_utils_dialog_replace(DIALOG_070,1,5,30,200, "If you have problems\
+with the camera try\
+using the Mario \
+perspective by pushing\
+the [R]-button.\
+Zoom out with [C]|.\
+But you may want to zoom\
+in if Mario enters\
+narrow tunnels.")
+
+smlua_text_utils_dialog_replace(DIALOG_071,1,3,30,200, "There is only 1 star\
+in this level.")
+
+smlua_text_utils_dialog_replace(DIALOG_072,1,5,30,200, "Welcome to the\
+Ombru-Sphere,\
+the mechanical temple\
+of darkness.\
+\
+No refunds for those\
+who fall into the\
+endless deep.")
+
+smlua_text_utils_dialog_replace(DIALOG_073,1,4,95,200, "This is the\
+'Kubus of Darkness'.\
+\
+It produces all the\
+darkness that causes\
+nighttime in every\
+video game.")
+
+smlua_text_utils_dialog_replace(DIALOG_074,1,5,30,200, "Unless you can fly:\
+\
+That was a dumb idea!")
+
+smlua_text_utils_dialog_replace(DIALOG_075,1,5,30,200, "Hey Mario, this is\
+Bowser!\
+Can't believe I couldn't\
+find this level last\
+time. Now, prepare for\
+challenges a la Bowser.")
+
+smlua_text_utils_dialog_replace(DIALOG_076,1,6,30,200, "Woohoo, I like it when\
+I'm in a field of nice\
+flowers.\
+This day is just perfect.\
+\
+Here, you can have this\
+star. I don't need it\
+to be happy.")
+
+smlua_text_utils_dialog_replace(DIALOG_077,1,2,150,200, "Mysterious hidden object\
+3 of 5\
+\
+Do you see it?\
+This object is full\
+of shining glory.\
+\
+Someone brought it here\
+in 2002.\
+That day was certainly\
+a dark day.\
+\
+Some people say this\
+temple was built that day.\
+\
+Well, I don't think so.\
+\
+But I'm sure there's\
+something missing.\
+I remember there was\
+a golden letter somewhere.\
+\
+Why would somebody throw\
+this object away?\
+\
+We may never know if its\
+glory will return one\
+day but right now I\
+doubt it.\
+\
+Kinda sad story.\
+\
+Poor bear and bird.")
+
+smlua_text_utils_dialog_replace(DIALOG_078,1,5,30,200, "78")
+
+smlua_text_utils_dialog_replace(DIALOG_079,1,4,30,200, "Owwwuu! Let me go!\
+Uukee-kee! I was only\
+teasing! Can't you take\
+a joke?\
+I'll tell you what, let's\
+trade. If you let me go,\
+I'll give you something\
+really good.\
+So, how about it?\
+\
+//Free him/ Hold on")
+
+smlua_text_utils_dialog_replace(DIALOG_080,1,1,30,200, "80")
+
+smlua_text_utils_dialog_replace(DIALOG_081,1,4,30,200, "81")
+
+smlua_text_utils_dialog_replace(DIALOG_082,1,4,30,200, "Hey! How did you find me?\
+\
+Don't tell anyone that\
+I'm here!\
+Here... take this star\
+if you want to and then\
+leave me alone, please.")
+
+smlua_text_utils_dialog_replace(DIALOG_083,1,6,30,200, "Did you know that\
+there are quite a lot\
+of stars in the \
+overworld?\
+\
+There are 4 in the first\
+part of it which is \
+called 'Valley of the\
+Toads'.\
+\
+There are 6 in the \
+second part which is\
+called 'Tower of the\
+East'.\
+\
+And there's one here\
+at the 'Magma Temple'.\
+And I have that one.\
+You can have it!")
+
+smlua_text_utils_dialog_replace(DIALOG_084,1,3,30,200, "-This rabbit can't speak\
+but I think he likes\
+you.\
+\
+Oh, he even has a present\
+for you!-")
+
+smlua_text_utils_dialog_replace(DIALOG_085,1,5,30,200, "This is the\
+'Kubus of Light'.\
+It provides energy for\
+every video game sun in\
+existence.")
+
+smlua_text_utils_dialog_replace(DIALOG_086,1,3,30,200, "Try out the Lakitu\
+perspective when you\
+attempt some wallkicks.")
+
+smlua_text_utils_dialog_replace(DIALOG_087,1,4,30,200, "10 stars are required to\
+open this door.")
+
+smlua_text_utils_dialog_replace(DIALOG_088,1,5,30,200, "Pst! I know a secret!\
+\
+I've heard there are\
+4 stars in a level\
+called 'Frozen Slide'.")
+
+smlua_text_utils_dialog_replace(DIALOG_089,1,5,95,200, "Sometimes I can see a \
+little rabbit over there.\
+\
+He's so cute. Maybe he \
+will come back one day.")
+
+smlua_text_utils_dialog_replace(DIALOG_090,1,6,30,200, "Mwahahaha, you again!\
+You may think I'm still\
+easy to defeat but\
+YOU ARE WRONG!!\
+\
+I didn't have the money \
+for some arena\
+edit software since \
+I already blew everything\
+on 2D castles but at \
+least these spike balls \
+are higher than before.")
+
+smlua_text_utils_dialog_replace(DIALOG_091,2,2,30,200, "Pst! I know a colorful\
+secret!\
+\
+RGB 356\
+\
+Do you get it?")
+
+smlua_text_utils_dialog_replace(DIALOG_092,1,5,30,200, "Mario!\
+I'll be honest to you:\
+I don't like you.\
+Hahahaha!\
+\
+Well, as you can see\
+I didn't have the time\
+to prepare this arena\
+which kinda is a shame.\
+But I guess there's no\
+way around it.\
+But trust me: You won't\
+beat this game.")
+
+smlua_text_utils_dialog_replace(DIALOG_093,1,5,30,200, "Mario, to be honest,\
+I'm impressed you made\
+it this far.\
+Getting here was way\
+harder than in the \
+original game.\
+I have to admit - good\
+job.\
+\
+And now...\
+I will try to kill you\
+like always.")
+
+smlua_text_utils_dialog_replace(DIALOG_094,1,4,30,200, "94")
+
+smlua_text_utils_dialog_replace(DIALOG_095,1,4,30,200, "Out of order until\
+the final release of\
+the game.\
+\
+Do not enter.")
+
+smlua_text_utils_dialog_replace(DIALOG_096,1,4,30,200, "Do you see the floating\
+platforms over there?\
+To get their treasure\
+you need to start your\
+flight from the highest\
+point possible.")
+
+smlua_text_utils_dialog_replace(DIALOG_097,1,5,30,200, "How did you get up here?\
+\
+YOU ARE A CHEATER!!!")
+
+smlua_text_utils_dialog_replace(DIALOG_098,1,2,95,200, "98")
+
+smlua_text_utils_dialog_replace(DIALOG_099,1,5,95,200, "Mysterious hidden object\
+2 of 5\
+\
+This object was lost some\
+months ago.\
+\
+But even before - it was\
+missing a lot of its\
+glory.\
+\
+Losing all its shining\
+power in late 2010 made\
+a lot of people lose\
+hope to see a certain\
+duo again.")
+
+smlua_text_utils_dialog_replace(DIALOG_100,1,3,95,200, "Warning.\
+Explosive sign.\
+Safety distance to\
+Bob-Ombs required.\
+\
+oh, and there's a \
+cannon to the left.")
+
+smlua_text_utils_dialog_replace(DIALOG_101,1,3,95,200, "If Mario wears the Wing\
+Cap, hold A when jumping\
+to glide slowly downwards.\
+This can help you reaching\
+the tower cannons.")
+
+smlua_text_utils_dialog_replace(DIALOG_102,1,5,30,200, "Warning! This slide\
+is kinda fast.\
+If Mario gets too fast\
+try jumping and do a\
+kick in mid-air.")
+
+smlua_text_utils_dialog_replace(DIALOG_103,1,4,95,200, "Want to get up there?\
+Combine a triple jump\
+with a wall jump.\
+(when doing the wall jump\
+hold the control stick\
+towards the wall)")
+
+smlua_text_utils_dialog_replace(DIALOG_104,1,5,30,200, "Please excuse that \
+Mario will always do\
+his 'I got a key'-\
+animation when beating\
+this level, even when\
+you get a star.")
+
+smlua_text_utils_dialog_replace(DIALOG_105,1,3,95,200, "105")
+
+smlua_text_utils_dialog_replace(DIALOG_106,1,2,95,200, "The cannon is activated.\
+C'mon! Hop in!")
+
+smlua_text_utils_dialog_replace(DIALOG_107,1,3,95,200, "107")
+
+smlua_text_utils_dialog_replace(DIALOG_108,1,2,95,200, "Boo!\
+You're trapped.\
+Now please scream.")
+
+smlua_text_utils_dialog_replace(DIALOG_109,1,4,95,200, "Hee hee heeeeee.")
+
+smlua_text_utils_dialog_replace(DIALOG_110,1,5,95,200, "This sign tells you\
+nothing.\
+Why are you reading it?")
+
+smlua_text_utils_dialog_replace(DIALOG_111,1,4,95,200, "I can see you.\
+\
+All the time.")
+
+smlua_text_utils_dialog_replace(DIALOG_112,1,4,30,200, "Lots of Dangers ahead!\
+\
+First:\
+Toxic air! \
+Don't breath in.\
+\
+SECOND:\
+Holes!\
+Don't fall into them!\
+\
+LAST AND MOST IMPORTANTLY:\
+Sucky camera!\
+STAY IN LAKITU'S PERSP.\
+IN THIS COURSE!")
+
+smlua_text_utils_dialog_replace(DIALOG_113,1,6,30,200, "You need the wall jump\
+to get up there.\
+Run and jump against a\
+wall and press [A] exactly\
+when you touch the wall.\
+\
+And remember to switch \
+to the Mario-perspective\
+by pushing [R] and zoom\
+out with [C]|.\
+Otherwise you may have\
+problems with the camera.")
+
+smlua_text_utils_dialog_replace(DIALOG_114,1,5,95,200, "Harharhar!!\
+You will never defeat\
+me. I can't even\
+believe I can stand on\
+this tiny platform.\
+\
+Or do you think you\
+can stomp on my back\
+three times without\
+falling down?")
+
+smlua_text_utils_dialog_replace(DIALOG_115,1,5,95,200, "o.O\
+...I didn't expect\
+this to happen...")
+
+smlua_text_utils_dialog_replace(DIALOG_116,1,5,95,200, "ARGH! How dare you!!!")
+
+smlua_text_utils_dialog_replace(DIALOG_117,1,1,95,200, "")
+
+smlua_text_utils_dialog_replace(DIALOG_118,1,6,95,200, "118")
+
+smlua_text_utils_dialog_replace(DIALOG_119,1,6,30,200, "WHO BOUGHT THOSE STUPID\
+BOMBS ANYWAY?\
+I already told you guys\
+this is a bad idea! But \
+you didn't listen!\
+Now I have to give Mario\
+this golden key!\
+YES, the GOLDEN key!\
+the expensive one!\
+And it's your fault!\
+...and Mario's.")
+
+smlua_text_utils_dialog_replace(DIALOG_120,1,4,30,200, "Ouchie!\
+You are mean :(\
+Take the key and leave\
+me alone.")
+
+smlua_text_utils_dialog_replace(DIALOG_121,1,5,30,200, "Argh! My back!\
+That hurts.\
+\
+You are a very evil person.\
+Do you know that?\
+\
+\
+Oh man! I lost again.\
+Like always. Where's my\
+next plan?\
+\
+Hmmm... oh yeah,\
+I remember.\
+\
+I will defeat you.\
+...in \
+Super Mario Galaxy 3!\
+\
+harhar, just kidding.\
+I don't want to be in\
+that series anymore.\
+These guys made me so\
+huge and I was so \
+horribly easy to beat!\
+simply pathetic!\
+If they release a SMG3,\
+they will have to ask\
+my brother.")
+
+smlua_text_utils_dialog_replace(DIALOG_122,1,4,30,200, "You'll find some walls\
+in this level that look\
+a bit like ice...\
+well, kind of.\
+\
+Don't try to touch them.\
+They are kinda sticky.\
+\
+Use a Vanish cap instead.")
+
+smlua_text_utils_dialog_replace(DIALOG_123,1,4,30,200, "Don't touch this wall.")
+
+smlua_text_utils_dialog_replace(DIALOG_124,1,4,30,200, "The way back to the\
+'Tower of the East'.")
+
+smlua_text_utils_dialog_replace(DIALOG_125,1,3,30,200, "Pst! I know a dangerous\
+secret!\
+\
+I've heard there are \
+4 stars in a level called\
+'Bowser's\
+Badlands-Battlefield'.")
+
+smlua_text_utils_dialog_replace(DIALOG_126,2,3,30,200, "Pst! I know a secret!\
+\
+I've heard there are\
+5 stars in a level called\
+'Bowser's Aquatic Castle'.")
+
+smlua_text_utils_dialog_replace(DIALOG_127,3,4,30,200, "Pst! I know a dark\
+secret!\
+\
+I've heard there are \
+6 stars in a level...\
+I forgot its name, \
+though. I think it had\
+something to do with\
+colorful rocks.")
+
+smlua_text_utils_dialog_replace(DIALOG_128,1,4,95,200, "HA! That doesn't count!\
+You have to throw me\
+onto the platform!")
+
+smlua_text_utils_dialog_replace(DIALOG_129,1,5,30,200, "Hello! You just entered...\
+\
+Hello?\
+Mario?\
+\
+WHERE ARE YOU???\
+I can't see you?!")
+
+smlua_text_utils_dialog_replace(DIALOG_130,1,5,30,200, "Waaaaaaah!\
+Look at your skin! It's\
+like... like METAL!\
+How terrifying...\
+I don't want to touch\
+you! And I believe your\
+enemies don't want to\
+either.")
+
+smlua_text_utils_dialog_replace(DIALOG_131,1,5,30,200, "That's not good for your\
+eyes, Mario!\
+\
+Anyways, the red Switch\
+is somewhere around.\
+Press it and...\
+\
+well, I think you already\
+know what happens.")
+
+smlua_text_utils_dialog_replace(DIALOG_132,1,4,30,200, "132")
+
+smlua_text_utils_dialog_replace(DIALOG_133,1,6,30,200, "Hey there!\
+I'm Toad. Please don't\
+run away.\
+\
+I know that we are pretty\
+useless all the time\
+but now we're are trying\
+our best!\
+\
+It's not much but...\
+err... I mean...\
+\
+You're our hero, please\
+save the princess.\
+She won't pay us as long\
+as she's kidnapped. :(\
+\
+I have to pay the rent\
+and the kids want these\
+new game Systems for\
+Christmas and that's so\
+expensive you know.\
+\
+What I'm trying to say...\
+I need MONEY. So if you\
+find enough money in a \
+level I'll give you a star.\
+Let's say 1★ per 100$s.\
+\
+I have 15★s...\
+Good luck.")
+
+smlua_text_utils_dialog_replace(DIALOG_134,1,5,30,200, "It is always useful to\
+use the Mario perspective\
+instead of the Lakitu\
+perspective. You can\
+switch between those\
+two by pushing R.\
+If you enter a narrow \
+tunnel or small room\
+zoom in with [C]^.\
+But sometimes it can\
+help to switch back to\
+Lakitu's perspective.\
+Give it a try!")
+
+smlua_text_utils_dialog_replace(DIALOG_135,1,5,30,200, "This level right here\
+can be pretty tricky.\
+If you can't find\
+a star just use [C]^ and\
+look around. It should\
+help.")
+
+smlua_text_utils_dialog_replace(DIALOG_136,1,6,30,200, "Molten Treasure Chest\
+\
+You need 75 stars to\
+open this door.")
+
+smlua_text_utils_dialog_replace(DIALOG_137,1,6,30,200, "Luminium-Sphere\
+\
+You need 85 stars to\
+open this door.")
+
+smlua_text_utils_dialog_replace(DIALOG_138,1,3,30,200, "Ombru-Sphere\
+\
+You need 95 stars to\
+open this door.")
+
+smlua_text_utils_dialog_replace(DIALOG_139,1,6,30,200, "The Crystal Palace\
+\
+You need 110 stars to \
+open this door.")
+
+smlua_text_utils_dialog_replace(DIALOG_140,1,6,30,200, "A Bonus for people who\
+can't stop playing this\
+game.\
+You need 125 stars to\
+open this door.")
+
+smlua_text_utils_dialog_replace(DIALOG_141,1,5,150,200, "You found 1 star!\
+\
+O-N-E S-T-A-R!\
+\
+\
+Now please don't feel\
+special. You achieved\
+pretty much nothing\
+at all.")
+
+smlua_text_utils_dialog_replace(DIALOG_142,1,5,150,200, "Three stars...\
+That's not much but\
+\
+...\
+\
+...well, it isn't much.\
+Nothing interesting\
+about it.")
+
+smlua_text_utils_dialog_replace(DIALOG_143,1,6,150,200, "You found 8 stars.\
+Oh boy! You are really\
+slow, do you know that?\
+\
+Two more stars and you\
+can open the first\
+star door.")
+
+smlua_text_utils_dialog_replace(DIALOG_144,1,6,150,200, "You've collected 60 stars!\
+\
+Oh wait, you didn't!\
+You are still so darn\
+slow!\
+\
+What? No, I'm NOT \
+Cranky Kong. \
+I just don't like\
+you.")
+
+smlua_text_utils_dialog_replace(DIALOG_145,1,6,150,200, "C'mon! By this time I had\
+already beaten the game!\
+50 stars...\
+That's not even half\
+of them!\
+\
+you need way more\
+to beat this game.")
+
+smlua_text_utils_dialog_replace(DIALOG_146,1,6,150,200, "Zzzzz...\
+Zzzzzzzzz...\
+\
+W-what? What is going \
+on?\
+\
+Oh, it's you again.\
+So you got your 70th\
+star?\
+Which year is it by the\
+way?\
+Now press [A] or [B] and hurry\
+up a bit. I'm getting\
+really tired.\
+\
+Oh, and you still need\
+5 stars to open the\
+next star door\
+(and there are like\
+one million left).")
+
+smlua_text_utils_dialog_replace(DIALOG_147,1,5,30,200, "The secret aquarium is\
+gone. Instead you can\
+try a challenge.\
+But only platforming\
+masters can beat it.")
+
+smlua_text_utils_dialog_replace(DIALOG_148,1,6,30,200, "Warning!\
+The water right here is\
+so cold - it hurts!")
+
+smlua_text_utils_dialog_replace(DIALOG_149,1,3,30,200, "Welcome to the\
+Frozen Slide.\
+Don't worry about a time \
+limit. This time you'll\
+face other problems")
+
+smlua_text_utils_dialog_replace(DIALOG_150,1,5,30,200, "-")
+
+smlua_text_utils_dialog_replace(DIALOG_151,1,4,30,200, "-")
+
+smlua_text_utils_dialog_replace(DIALOG_152,1,3,30,200, "-")
+
+smlua_text_utils_dialog_replace(DIALOG_153,1,4,30,200, "-")
+
+smlua_text_utils_dialog_replace(DIALOG_154,1,5,30,200, "I already gave you a\
+star.\
+Now please leave me\
+alone.")
+
+smlua_text_utils_dialog_replace(DIALOG_155,1,6,30,200, "I'm sorry but there's\
+nothing left I could\
+give you except for my\
+happiness.\
+But I don't want to give\
+it away.")
+
+smlua_text_utils_dialog_replace(DIALOG_156,1,5,30,200, "There are 4 stars in\
+the first part of the\
+overworld.\
+('Valley of the Toads')\
+\
+There are 6 stars in\
+the second part of the\
+overworld.\
+('Tower of the East')\
+\
+You already got the\
+only star from here.\
+('Magma Temple')")
+
+smlua_text_utils_dialog_replace(DIALOG_157,1,5,30,200, "157")
+
+smlua_text_utils_dialog_replace(DIALOG_158,1,6,30,200, "Remember to zoom in\
+when you enter narrow\
+tunnels.")
+
+smlua_text_utils_dialog_replace(DIALOG_159,1,6,30,200, "Hmmm...\
+I wonder what's over\
+there.")
+
+smlua_text_utils_dialog_replace(DIALOG_160,1,4,30,200, "160")
+
+smlua_text_utils_dialog_replace(DIALOG_161,1,4,30,200, "Mario!!!\
+\
+MARIO!!!!!\
+\
+It's me - Yoshi!\
+\
+What do you mean with\
+'I don't remember you'?\
+Don't be so mean to me,\
+you'll make me cry.\
+Well, okay, how about this?\
+I've heard there are\
+151 stars in the game.\
+You didn't expect that,\
+did you?\
+\
+Okay, here, take these\
+mushies and search for \
+it.\
+\
+(I hope they make him\
+sick. I hate him so much.\
+Gotta go now.)")
+
+smlua_text_utils_dialog_replace(DIALOG_162,1,4,30,200, "-Stop assaulting this\
+rabbit. He hasn't done\
+anything to you!\
+\
+...you, you won't let\
+him go? Well, okay...\
+take this star.\
+But please let him go.-")
+
+smlua_text_utils_dialog_replace(DIALOG_163,1,5,30,200, "Noooo! You've really\
+beaten me this time,\
+Mario! I can't stand\
+losing to you!\
+...again!\
+\
+...and again and again\
+and again.\
+\
+...and again and again.\
+over and over again.\
+\
+Hmm, looks like you got\
+at least 120 ★s.\
+Can't be more precise\
+as the developers didn't\
+give me more text.\
+\
+Pah! Do you think that's\
+all? There are more out\
+there.")
+
+smlua_text_utils_dialog_replace(DIALOG_164,1,4,30,200, "Mario! What's up, pal?\
+I haven't been on the\
+slide lately, so I'm out\
+of shape.\
+Still, I'm always up for a\
+good race, especially\
+against an old sleddin'\
+buddy.\
+Whaddya say?\
+Ready...set...\
+\
+//Go//// Don't Go")
+
+smlua_text_utils_dialog_replace(DIALOG_165,1,5,30,200, "165")
+
+smlua_text_utils_dialog_replace(DIALOG_166,1,4,30,200, "166")
+
+smlua_text_utils_dialog_replace(DIALOG_167,1,4,30,200, "Go back to where you\
+came from.")
+
+smlua_text_utils_dialog_replace(DIALOG_168,1,5,30,200, "168")
+
+smlua_text_utils_dialog_replace(DIALOG_169,1,4,30,200, "169")
+end
+
+------------
+-- sm74ee --
+------------
+
+local function dialog_swap_sm74ee()
+if sDialogsEE then return end
+smlua_text_utils_dialog_replace(DIALOG_000,1,6,30,200, "Welcome to another\
+devilish level.")
+
+smlua_text_utils_dialog_replace(DIALOG_001,1,4,95,200, "To the frustrated\
+coin collector:\
+You need the metal cap\
+to get everything you\
+strive for.")
+
+smlua_text_utils_dialog_replace(DIALOG_002,1,4,95,200, "Little warning:\
+Some towers have in-\
+visible walls for what-\
+ever reason.\
+But considering you use\
+savestates anyway and\
+this level isn't that\
+hard, this shouldn't\
+cause much trouble.")
+
+smlua_text_utils_dialog_replace(DIALOG_003,1,5,95,200, "Oh no! Some time ago\
+this was a really nice\
+battlefield and now\
+there's this green\
+crap all over the place!\
+...what?\
+Is it not allowed to make\
+some jokes?")
+
+smlua_text_utils_dialog_replace(DIALOG_004,1,3,95,200, "ARRRRRH! You landlubber!\
+Here starts the big\
+treasure hunt!\
+Dive down and find the \
+gold!")
+
+smlua_text_utils_dialog_replace(DIALOG_005,1,3,30,200, "Hey, Mario! Is it true\
+that you beat the Big\
+Bob-omb? Cool!\
+You must be strong. And\
+pretty fast. So, how fast\
+are you, anyway?\
+Fast enough to beat me...\
+Koopa the Quick? I don't\
+think so. Just try me.\
+How about a race to the\
+mountaintop, where the\
+Big Bob-omb was?\
+Whaddya say? When I say\
+『Go,』 let the race begin!\
+\
+Ready....\
+\
+//Go!////Don't Go")
+
+smlua_text_utils_dialog_replace(DIALOG_006,1,3,30,200, "What you are looking at\
+right now is a rare\
+exemplar of the\
+Tundra Piranha Plant.\
+Please keep distance\
+while observing.")
+
+smlua_text_utils_dialog_replace(DIALOG_007,1,5,30,200, "4 checkpoints are close\
+but one is far, right in\
+the middle of three\
+points in the coldest\
+spot.")
+
+smlua_text_utils_dialog_replace(DIALOG_008,1,4,30,200, "Whoever wants to get all\
+the stars needs nerves\
+of steel.\
+Even when the camera is\
+a bitch, keep on strugg-\
+ling and you may be\
+revarded. I mean...\
+I tested it, it's \
+possible. (except you use\
+the wrong way, who knows)")
+
+smlua_text_utils_dialog_replace(DIALOG_009,1,5,30,200, "Hey, little boy!\
+Have I seen you before?\
+I think my brother raced\
+against you and he said\
+you are hard to beat!\
+But he already passed\
+away so I have to restore\
+his honor.\
+...but be warned, he\
+showed me a secret\
+shortcut.\
+You want to give the\
+race a try?\
+\
+//Sure////Not now")
+
+smlua_text_utils_dialog_replace(DIALOG_010,1,4,30,200, "Some claim the red switch\
+is now pressed.\
+\
+Do you want to save\
+despite this being no\
+challenge at all?\
+\
+//Yep////Nope")
+
+smlua_text_utils_dialog_replace(DIALOG_011,1,4,30,200, "You activated the metal\
+cap and finished the\
+easiest task in this\
+level.\
+You'll have fun with\
+the rest xD\
+\
+Save?\
+\
+//Why not////NO")
+
+smlua_text_utils_dialog_replace(DIALOG_012,1,4,30,200, "Well, you could think\
+that you really\
+activated the blue switch\
+but in reality you did\
+...exactly that.\
+trololol.\
+\
+Wanna save?\
+\
+//Of course////...")
+
+smlua_text_utils_dialog_replace(DIALOG_013,1,5,30,200, "You collected 100 shiny\
+round objects.\
+Maybe you feel proud\
+now, although you should\
+not.\
+Save?\
+\
+//Yo!////Nope")
+
+smlua_text_utils_dialog_replace(DIALOG_014,1,4,30,200, "You literally got a star\
+for free although you\
+don't even deserve that.\
+Do you seriously want\
+to save now?!?\
+\
+//Indeed//Not now")
+
+smlua_text_utils_dialog_replace(DIALOG_015,1,4,30,200, "Thanks to Zentrux all\
+courses of the first and\
+third overworld have\
+their own exits.\
+In addition, the 2nd\
+overworld has been\
+improved so you don't\
+have to walk that long\
+to the level entrances :)")
+
+smlua_text_utils_dialog_replace(DIALOG_016,1,3,30,200, "Do you know the\
+'fast wall kicks'?\
+Use the long jump to\
+jump against a wall.\
+If you hit the perfect\
+moment, you'll jump\
+much higher and faster\
+with your wall jump.\
+You can see that you\
+are successful when no\
+little stars appear.\
+But keep in mind that\
+once you fail at one\
+jump you can't keep\
+the combo going. In\
+that case you have\
+to start at the long\
+jump again.\
+Should I warn you when\
+you need this jump?\
+...I won't do it anyway.\
+This isn't a pony or\
+gardening game.")
+
+smlua_text_utils_dialog_replace(DIALOG_017,1,4,30,200, "You won't stop, will you?\
+But you won't defeat me\
+a third time.\
+Just look at this\
+newfangled anti-plumber-\
+apparats. HA!")
+
+smlua_text_utils_dialog_replace(DIALOG_018,1,4,30,200, "On the second platform\
+there's an invisible\
+wall. Don't know why,\
+but you can pass it\
+at the left side.")
+
+smlua_text_utils_dialog_replace(DIALOG_019,1,2,30,200, "Beliebe me...\
+You don't want to go\
+down there.\
+But if I can't stop you\
+here's a hint cause the\
+camera sucks a certain\
+body peace.\
+Keep in Lakitu perspective,\
+not zoomed out.\
+And maybe it's just my\
+imagination but it could\
+be helpful to hold\
+[C]| while in water.\
+Good luck.")
+
+smlua_text_utils_dialog_replace(DIALOG_020,1,6,95,150, "INTRO")
+
+smlua_text_utils_dialog_replace(DIALOG_021,1,5,95,200, "MWAHAHAHAHA!!!\
+I (that's Bowser) am so\
+evil, harhar!\
+I froze this ugly clean\
+beach. Now every dive\
+is so refreshing!\
+Aren't I awesome? :D")
+
+smlua_text_utils_dialog_replace(DIALOG_022,1,2,95,200, "YOU SHALL NOT PASS!")
+
+smlua_text_utils_dialog_replace(DIALOG_023,1,3,95,200, "This key doesn't fit!\
+Maybe it's for the\
+basement...")
+
+smlua_text_utils_dialog_replace(DIALOG_024,1,5,95,200, "You need Star power to\
+open this door. Recover a\
+Power Star from an enemy\
+inside one of the castle's\
+paintings.")
+
+smlua_text_utils_dialog_replace(DIALOG_025,1,4,95,200, "It takes the power of\
+3 Stars to open this\
+door. You need [%] more\
+Stars.")
+
+smlua_text_utils_dialog_replace(DIALOG_026,1,4,95,200, "It takes the power of\
+8 Stars to open this\
+door. You need [%] more\
+Stars.")
+
+smlua_text_utils_dialog_replace(DIALOG_027,1,4,95,200, "You should already know\
+that you need 30 stars\
+for this door.\
+Geez, if you are really\
+that dumb I have my doubts\
+that you'll get far.")
+
+smlua_text_utils_dialog_replace(DIALOG_028,1,4,95,200, "C'mon! 50 stars!\
+Before you get those\
+you can camp here all\
+day long.\
+The door will stay closed\
+and doesn't like you.")
+
+smlua_text_utils_dialog_replace(DIALOG_029,1,5,95,200, "To open the door that\
+leads to the 『endless』\
+stairs, you need 70\
+Stars.\
+Bwa ha ha!")
+
+smlua_text_utils_dialog_replace(DIALOG_030,1,6,30,200, "So there you are!\
+Took you an eternity!\
+Do you know how long\
+we had to wait?!?!\
+...\
+What do you mean with\
+'Didn't I just beat Bowser\
+not long ago'?\
+You seem to be a bit\
+under the weather after\
+last night. And now for\
+the stupid:\
+YOU SLEPT UNTIL NOW!\
+I don't know what dreams\
+of easy-peasy Peach-\
+collecting you had, but\
+THIS IS THE REAL LIFE.\
+And it is anything but\
+nice so stop living in\
+your dream world!\
+Peach was captured by\
+Bowser years ago and he\
+used her magic powers\
+to destroy the world.\
+So do you keep sleeping\
+or do you face the true\
+challenges of LUGMILLORD?")
+
+smlua_text_utils_dialog_replace(DIALOG_031,1,5,30,200, "Ah, crap, I lost.\
+You are really nimble.\
+Here, take this star\
+as a price.\
+And now... I'll continue\
+searching for my brother's\
+tomb. I bought some\
+flowers for him...")
+
+smlua_text_utils_dialog_replace(DIALOG_032,1,5,30,200, "Although we are not\
+allowed to help you I\
+have to for some stupid\
+reason and that pissed\
+me off!\
+So LISTEN!\
+When you are looking for\
+100 coins or the red\
+coins, keep a save coin\
+for last cause some\
+coins are just bull★★★★\
+if you get them last.\
+And now, leave me alone.")
+
+smlua_text_utils_dialog_replace(DIALOG_033,1,6,30,200, "Just look under what\
+conditions we have to\
+live... How very\
+pitiful. The bare\
+survival has become so\
+hard and that's all just \
+because you failed!\
+How could you be so\
+careless?\
+We supported you for \
+years but it looks like\
+you forgot what we\
+were fighting for!")
+
+smlua_text_utils_dialog_replace(DIALOG_034,1,6,30,200, "It was a smart step from\
+Bowser to act as if he\
+can't do anything right\
+just to make us\
+mistakenly think we\
+are on the safe side.\
+But you did really bad.\
+And now we have it so\
+much harder! That's your \
+fault! Deal with it!")
+
+smlua_text_utils_dialog_replace(DIALOG_035,1,5,30,200, "I remember how this\
+place looked some time\
+ago...\
+I wish all that stuff\
+would have never happened.\
+I miss the green grass,\
+the fresh water,\
+the friendly neighbors,\
+the ATM with\
+malfunctions...\
+How am I supposed to\
+get rid of my debts now?\
+I could cry...\
+Why did I buy that\
+villa...\
+and that boat...\
+and all te other\
+fancy crap. What am I\
+supposed to do now...")
+
+smlua_text_utils_dialog_replace(DIALOG_036,1,5,30,200, "The emmission of the lava\
+caused this door to turn\
+black. But it still needs\
+10 stars to open.\
+And that won't change\
+soon, so I recommend\
+you play this game\
+instead of reading this\
+sign.\
+By the way, I'm an\
+epic sign. When you\
+don't look I get a\
+bushy mustache.")
+
+smlua_text_utils_dialog_replace(DIALOG_037,1,2,30,200, "These glitchy textures\
+are a memorial of\
+laziness.\
+So now they are con-\
+sidered a historial\
+building and I am not\
+allowed to get rid\
+of them.")
+
+smlua_text_utils_dialog_replace(DIALOG_038,1,3,95,200, "The (censored) blood\
+of a suicidle star dis-\
+gusts the door so much\
+that you can open it\
+now.")
+
+smlua_text_utils_dialog_replace(DIALOG_039,1,4,30,200, "You didn't expect a star\
+for free here, did you?\
+Find the 5 checkpoints\
+an return to this place\
+then.")
+
+smlua_text_utils_dialog_replace(DIALOG_040,1,3,30,200, "Welcome to the Dead Land.\
+This used to be the\
+source of live some time\
+ago. But everything dried\
+out.\
+Back then, when this\
+was still a swamp, dead\
+bodies were disposed at\
+this place. I guess they\
+are all still beneath\
+the ground...\
+Now the ground is too\
+hard to bury the corpses.\
+Only a few spots still\
+desire more souls, hehehe.\
+Anways, the people then\
+started to place the \
+bodies inside those \
+towers. I heard not\
+all the tombs are\
+closed. Maybe there's\
+also one for you, hehehe.\
+But you won't find any\
+living creature here\
+except for some young\
+fellows who seek for\
+adrinalin.")
+
+smlua_text_utils_dialog_replace(DIALOG_041,1,3,30,200, "YEAH! I knew I could\
+pull it off!\
+And if I knew where\
+my brother is buried\
+I would give him some\
+flowers...")
+
+smlua_text_utils_dialog_replace(DIALOG_042,1,4,30,200, "Don't think the camera\
+guy does his job\
+according to his payment.\
+But who am I telling\
+this...\
+we are in trouble because\
+of YOU!\
+So keep this in mind:\
+No one will give you\
+advice for the camera.\
+Either you know\
+how to use these 5\
+buttons properly or\
+you are in the wrong\
+game!")
+
+smlua_text_utils_dialog_replace(DIALOG_043,1,5,30,200, "If you already can't\
+get passed the start\
+I recommend you continue\
+playing pony and\
+gardening games.")
+
+smlua_text_utils_dialog_replace(DIALOG_044,1,5,95,200, "You dare to enter the\
+levels of the Plasma-\
+Temple, you insane\
+person?\
+Be warned, we won't\
+give you a hand but\
+rather a chainsaw.\
+Here at the acid peaks\
+we will test how you\
+survive under permanent\
+time pressure.\
+At least I can tell\
+you that the hardest\
+challenge await in\
+later levels.")
+
+smlua_text_utils_dialog_replace(DIALOG_045,1,6,95,200, "So this is the biggest\
+of all challenges.\
+Get all 150 stars and\
+the grill will open\
+so you can enter the\
+super-duper-ultra-secret\
+bonus level.")
+
+smlua_text_utils_dialog_replace(DIALOG_046,1,5,30,200, "Weird, everything looks\
+so normal here.\
+Did we travel back in\
+time?")
+
+smlua_text_utils_dialog_replace(DIALOG_047,1,2,95,200, "Beaver badaboom!\
+The cannon shall be\
+Ohohohohopen!")
+
+smlua_text_utils_dialog_replace(DIALOG_048,1,4,30,200, "I'm the king of all\
+signs but an imbecil\
+like you wouldn't notice\
+that. When you don't\
+look I'm wearing a \
+monocle. It suits me\
+very well.")
+
+smlua_text_utils_dialog_replace(DIALOG_049,1,5,30,200, "I wonder where Yoshi\
+is right now.\
+...\
+Oh, that's right...\
+the Toads didn't have\
+anything left to eat.")
+
+smlua_text_utils_dialog_replace(DIALOG_050,1,4,30,200, "welcome, supreme gamer.\
+You passed all the\
+brutal challenges to get\
+access to the most\
+peaceful place of the\
+kingdom:\
+The Triarc-Bridge.\
+This won't be another\
+insane last task. It's\
+already the price.\
+enjoy the view, collect\
+the coins along the way\
+and get the\
+STAR OF TRIUMPH.")
+
+smlua_text_utils_dialog_replace(DIALOG_051,1,6,30,200, "I hope you had fun with\
+this hack despite of\
+or maybe because of the\
+difficulty.\
+A lot of work and testing\
+went into this and I\
+hope I won't receive\
+murder threats now.\
+And if I do get some,\
+I did my job correctly :P\
+Congratulations for\
+accomplishing every\
+goal. You are truly a\
+good player.\
+With friendly regards,\
+LUGMILLORD.")
+
+smlua_text_utils_dialog_replace(DIALOG_052,1,5,30,200, "Veneno-Info 1 of 3\
+\
+This is the mechanical\
+temple of poison.\
+It may be already\
+devilishly difficult\
+(say that fast 10\
+times in a row) but\
+tasks will continue to\
+get harder step by step\
+until they reach the\
+maximum.\
+But since we haven't\
+reached 'beyond good and\
+evil' yet, I will take\
+you there.\
+So let's start slowly.\
+The amount of red coins\
+in this course is 14.\
+I'm even so nice that\
+I tell you, that there\
+are no red coins\
+beyond the warp block\
+that you'll see\
+eventually.\
+And now, let's start!")
+
+smlua_text_utils_dialog_replace(DIALOG_053,1,5,30,200, "Veneno-Info 2 of 3\
+\
+This is the\
+'Kubus of toxic\
+substances'.\
+Just because of this\
+cube they have an effect.\
+...may not make much\
+sense but that's it.")
+
+smlua_text_utils_dialog_replace(DIALOG_054,1,5,30,200, "Veneno-Info 3 of 3\
+\
+You are approaching the\
+top of the level.\
+Do you feel the tension,\
+since you are close to\
+the end of the game?\
+There may be a long way\
+left but have a look back\
+at what you already\
+achieved.\
+You deserve a certain\
+pride even when I'm so\
+mean.\
+Enjoy the moment.")
+
+smlua_text_utils_dialog_replace(DIALOG_055,1,4,30,200, "Hey-ey, Mario, buddy,\
+howzit goin'? Step right\
+up. You look like a fast\
+sleddin' kind of guy.\
+I know speed when I see\
+it, yes siree--I'm the\
+world champion sledder,\
+you know. Whaddya say?\
+How about a race?\
+Ready...\
+\
+//Go//// Don't Go")
+
+smlua_text_utils_dialog_replace(DIALOG_056,1,6,30,200, "Crudelo-Info 1 of 5\
+\
+You enter the\
+Crudelo-Sphere, the\
+mechanical temple of\
+cruelty? How Foolish.\
+This level will do\
+everything to make your\
+life a hell. Well...\
+we pretty much already\
+are in hell...\
+so nobody will hear your\
+cry for help.\
+GIVE UP!\
+The first quietus:\
+The amount of red coins\
+has been increased to 20.\
+Fed up now?")
+
+smlua_text_utils_dialog_replace(DIALOG_057,1,4,30,200, "Crudelo-Info 2 of 5\
+\
+This is the frightening\
+'Kubus of Death'.\
+When no lifes are left,\
+this will throw you\
+into the\
+GAME OVER Zone.")
+
+smlua_text_utils_dialog_replace(DIALOG_058,1,4,30,200, "Crudelo-Info 3 of 5\
+\
+How does it feel to get\
+up here?\
+Exhausting and painful.\
+And yet you achieved\
+pretty much nothing.\
+Isn't that demotivating?")
+
+smlua_text_utils_dialog_replace(DIALOG_059,1,4,30,200, "Crudelo-Info 4 of 5\
+\
+So high up.\
+So deadly the fall.\
+So much passed.\
+So few achieved.")
+
+smlua_text_utils_dialog_replace(DIALOG_060,1,4,30,200, "Crudelo-Info 5 of 5\
+\
+There we are.\
+At the top. \
+Still, I won't laud you.\
+Anyway, climbing up here\
+may be insultingly hard\
+but this isn't worth a\
+star at this time.\
+Look out for the gold,\
+it has to be somewhere.")
+
+smlua_text_utils_dialog_replace(DIALOG_061,1,4,30,200, "Crudelo-Info 6 of 5\
+\
+...wait, WHAT?\
+There's something wrong.\
+You shouldn't be here.\
+Shhhh! Away with you!")
+
+smlua_text_utils_dialog_replace(DIALOG_062,1,3,30,200, "Huh?\
+You got here?\
+How did you do that?\
+Astonishing. It has\
+to be a pure pain to\
+collect 125 stars.\
+Well, are you still happy,\
+that you reached this\
+level?\
+...enjoy it as long as\
+you can.\
+Cause this will be as\
+difficult as possible.\
+The Ztar Zanctuary is\
+the center of evil\
+energy which will place\
+super unfair obstacles\
+right in your way.\
+Until now it was extreme,\
+now you have to go\
+to the border of\
+possibility.\
+Good luck and\
+frustration resistance.")
+
+-- smlua_text_utils_dialog_replace(DIALOG_063,1,5,30,200, "It's really a shame but\
+-- this level was way too\
+-- big for the level importer\
+-- so I had to split it\
+-- into two parts.\
+-- That means I CAN'T place\
+-- red coins in the whole\
+-- level. Sad, isn't it?\
+-- I know that you would\
+-- enjoy collecting 30\
+-- red coins, right?\
+-- Well then, instead,\
+-- the red coins are all\
+-- beyond the cannon.\
+-- And since they are so\
+-- close together\
+-- I won't tell you how\
+-- many there are.\
+-- \
+-- (Well, honestly, I forgot\
+-- how many I placed.)")
+
+smlua_text_utils_dialog_replace(DIALOG_063,1,5,30,200, "It's really a shame but\
+this level was way too\
+big for the level importer\
+so I had to split it\
+into two parts.\
+Nah! Just kidding!\
+You're no longer playing\
+a Nintendo 64 rom-hack.\
+It's the pc port we're\
+talking about!\
+That means I CAN place\
+red coins in the whole\
+level. Great, isn't it?\
+I know that you would\
+enjoy collecting 30\
+red coins. So, after 9\
+years, it's finally\
+possible. Have fun!")
+
+smlua_text_utils_dialog_replace(DIALOG_064,1,5,30,200, "You should already know\
+the concept of this\
+level.\
+Pass both paths and\
+open the cannon.\
+...if you can ever get\
+that far.\
+Now you may think\
+'Nah, it can't get that\
+much harder.'\
+Well, you're wrong. :P")
+
+smlua_text_utils_dialog_replace(DIALOG_065,1,6,30,200, "That you are reading \
+this...\
+it's so unlikely but you\
+did it.\
+...up to here.\
+But this isn't the end of\
+the level, MWAHAHAHAHA!!!")
+
+smlua_text_utils_dialog_replace(DIALOG_066,1,5,30,200, "Well... ehm...\
+I get the feeling you \
+don't know how to give up.\
+Incredible that you are\
+here! That was so brutal!\
+Well, I could already\
+congratulate you but\
+since the definition\
+of 'complete' prohibits\
+me to do so I have to\
+put that back just a\
+little longer. Have fun\
+with the end boss.\
+Will you also try the\
+150-star-challenge?")
+
+smlua_text_utils_dialog_replace(DIALOG_067,1,5,30,200, "'Ello. That you are here\
+means that you aren't\
+toooooooooo bad.\
+But 'good' is still some-\
+thing else. As you can\
+see, there's not really\
+much that can be changed\
+here. Too bad, too bad.")
+
+smlua_text_utils_dialog_replace(DIALOG_068,1,5,30,200, "This door leads to the\
+frightening Acid Peaks.\
+The admission charge is\
+80 stars.")
+
+smlua_text_utils_dialog_replace(DIALOG_069,1,6,30,200, "Warning, the Veneno-\
+Sphere which is behind \
+this door, makes many \
+players get a depression.\
+But you can't get there\
+without 95 stars anyway.")
+
+smlua_text_utils_dialog_replace(DIALOG_070,1,5,30,200, "It requires huge amounts\
+of skill to get the 110\
+stars that are needed\
+to open the way to the\
+Crudelo-Sphere.")
+
+smlua_text_utils_dialog_replace(DIALOG_071,1,3,30,200, "Only the very best pro\
+gamers will ever reach\
+the legendary\
+Ztar Zanctuary.\
+125 are required.")
+
+smlua_text_utils_dialog_replace(DIALOG_072,1,5,30,200, "It is done!\
+The sewage grill of doom\
+has been made by master\
+blacksmith Zentrux.\
+You can find it somewhere\
+in a level within this\
+temple. But it is so\
+strong that you need\
+all 150 stars to break it.\
+...just look at your\
+face xD\
+To uncover the last\
+secret of this game you\
+have to use all of your\
+skill (or way more).\
+Although it's a bit sad\
+that so much work went\
+into the 'price' and\
+hardly anyone will see\
+it. But those who will\
+pull it off will feel\
+awesome.\
+But will anyone even\
+manage to get there?\
+I'm really curious\
+who will reach this\
+extreme goal and proof\
+that he or she is a true\
+gaming champion.")
+
+smlua_text_utils_dialog_replace(DIALOG_073,1,4,95,200, "Back Story 1 of 5\
+\
+When Bowser kidnapped\
+Peach again for the 2000th\
+time (which wasn't\
+difficult) he waited for\
+the arrival of his\
+arch enemy like usual.\
+But that certain person\
+didn't seem to be in the\
+mood to save that stupid\
+cow every week again.\
+You can't really blame\
+him but that way, Bowser\
+reached his goal.\
+The reason is that he\
+hadn't enough time\
+before to use Peach's\
+magical powers...")
+
+smlua_text_utils_dialog_replace(DIALOG_074,1,5,30,200, "Back Story 2 of 5\
+\
+The secret powers of\
+Princess Peach lie in\
+her crown. It contains\
+magical stones which\
+have been passed from\
+generation to generation.\
+In possession of a pure\
+soul the kingdom will\
+face golden times.\
+But in possession of an\
+evil person everything\
+will perish.\
+But the magical stones\
+have a protection\
+mechanism. It takes a\
+while to break this\
+barrier. Even the evilest\
+of all evil enemies\
+needs a lot of time for\
+it. But due to Mario's\
+break Bowser could\
+finally use this power.\
+...I mean, is there any\
+other reason why he\
+should kidnap that\
+useless brat?")
+
+smlua_text_utils_dialog_replace(DIALOG_075,1,5,30,200, "Back story 3 of 5\
+\
+However, the magical\
+power is only active when\
+the original carrier\
+is close to it.\
+For that reason Bowser\
+kept Peach at a safe\
+spot. But it looks\
+as if he likes to show\
+his 'treasure' to the\
+public.\
+Bowser uses the magical\
+powers to overcloud the\
+kingdom. At a lot of\
+places the sun got\
+darker, the water was\
+tainted.\
+The life of the popu-\
+lation became difficult\
+and lots died because of\
+hunger and diseases.")
+
+smlua_text_utils_dialog_replace(DIALOG_076,1,6,30,200, "WAAAAAAAAAAAAAAAHHH!!!!\
+...\
+......\
+.........\
+oh, it's you, Mario!\
+I was already scared\
+that you could be an\
+evil monster that's\
+trying to eat me!\
+Now I'm just scared that\
+you are trying to eat me.\
+nah, just kidding.\
+But you know, it's\
+really dangerous around\
+here recently.\
+As Bowser is ruling\
+the Mushroom kingdom\
+for a long time span,\
+you aren't safe anywhere.\
+I can't take it any\
+longer...\
+this consistent fear is\
+weakening the will to\
+live. Please, Mario,\
+do your best and defeat\
+Bowser, no matter how\
+difficult it may be.\
+Here, I have a star for\
+you to encourage you.\
+I hope it helps reaching\
+our goal.")
+
+smlua_text_utils_dialog_replace(DIALOG_077,1,2,150,200, "Back Story 5 of 5\
+\
+By now many years have\
+passed. The world lived\
+with it and Bowser had\
+enough time that he used\
+to make it impossible for\
+Mario to safe Peach.\
+For a long time it really\
+seemed to work. Most of\
+the rescue attempts\
+were unsuccessful.\
+But since you are reading\
+this sign there is a\
+slight chance that you\
+could defeat King Bowser!\
+So enter the dark\
+Sanctuary and tell him\
+who's the true winner!")
+
+smlua_text_utils_dialog_replace(DIALOG_078,1,5,30,200, "Back Story 4 of 5\
+\
+The bad situation made\
+a big hatred grow\
+against Mario which was\
+the case in many\
+communities.\
+...so it's all Mario's\
+fault? Is that fair?\
+The guardians of the\
+mushroom palace could\
+also do a better job,\
+right?\
+They seem to be pretty\
+overpayed.\
+What do you think?")
+
+smlua_text_utils_dialog_replace(DIALOG_079,1,4,30,200, "Owwwuu! Let me go!\
+Uukee-kee! I was only\
+teasing! Can't you take\
+a joke?\
+I'll tell you what, let's\
+trade. If you let me go,\
+I'll give you something\
+really good.\
+So, how about it?\
+\
+//Free him/ Hold on")
+
+smlua_text_utils_dialog_replace(DIALOG_080,1,1,30,200, "80")
+
+smlua_text_utils_dialog_replace(DIALOG_081,1,4,30,200, "81")
+
+smlua_text_utils_dialog_replace(DIALOG_082,1,4,30,200, "Argh, I'm so pissed off!\
+The other Toads around\
+here are always in such\
+a bad mood. That even\
+had an effect on me :(\
+Back then I loved flowers.\
+Now I just want to tear\
+that stupid weed out of\
+the ground!\
+And before I destroy this\
+valuable star I give it\
+to you. Maybe it helps\
+you or whatever.")
+
+smlua_text_utils_dialog_replace(DIALOG_083,1,6,30,200, "FINALLY! You found me...\
+I found this room some\
+time ago and wanted to\
+know what it is for.\
+So I dug a tunnel.\
+But when I eventually\
+reached it this strange\
+purple matter flooded my\
+entrance tunnel. And now\
+I'm stuck.\
+Here used to be a warp\
+pipe. But after that long\
+time... well, looks like\
+it was out of order.\
+Anyway, I tried to use\
+it as a boat and failed\
+as you can see.\
+Well...\
+Can you get me out of\
+here somehow?\
+I can give you a star\
+if you promise to save\
+me.")
+
+smlua_text_utils_dialog_replace(DIALOG_084,1,3,30,200, "Ah, a bunny! The Toads\
+are really hungry!\
+That deserves a price.\
+And since we have\
+space-age-technology\
+we can transmit it right\
+now!")
+
+smlua_text_utils_dialog_replace(DIALOG_085,1,5,30,200, "85")
+
+smlua_text_utils_dialog_replace(DIALOG_086,1,3,30,200, "86")
+
+smlua_text_utils_dialog_replace(DIALOG_087,1,4,30,200, "87")
+
+smlua_text_utils_dialog_replace(DIALOG_088,1,5,30,200, "88")
+
+smlua_text_utils_dialog_replace(DIALOG_089,1,5,95,200, "89")
+
+smlua_text_utils_dialog_replace(DIALOG_090,1,6,30,200, "90")
+
+smlua_text_utils_dialog_replace(DIALOG_091,2,2,30,200, "91")
+
+smlua_text_utils_dialog_replace(DIALOG_092,1,5,30,200, "So you reached this\
+point (extremely smart\
+statement, I know).\
+That means that you\
+have a fraction of\
+something that could be\
+called 'skill'. But I\
+can still only laugh\
+because I know what\
+lies in front you and\
+it's so ridiculously\
+difficult that I'm\
+having fun watching\
+you fail, mwahaha.\
+But this fight right\
+here will be pretty\
+boring, sorry.")
+
+smlua_text_utils_dialog_replace(DIALOG_093,1,5,30,200, "Jesus, this is nuts.\
+Somehow there's\
+ALWAYS some addicted\
+person who ALWAYS BEATS\
+EVERYTHING!\
+I really tried everything\
+this time to stop you.\
+EVERYTHING I HAD!!!\
+I hope my last flame\
+thrower reserve can stop\
+you a little longer...\
+But now I can say only\
+one thing:\
+WOAH SHIP, MAH BOI!\
+...who... or rather...\
+WHAT ARE YOU!!!\
+MONSTER!!!\
+GO AWAY!!!\
+I'M AFRAID OF YOU!!!")
+
+smlua_text_utils_dialog_replace(DIALOG_094,1,4,30,200, "94")
+
+smlua_text_utils_dialog_replace(DIALOG_095,1,4,30,200, "98")
+
+smlua_text_utils_dialog_replace(DIALOG_096,1,4,30,200, "96")
+
+smlua_text_utils_dialog_replace(DIALOG_097,1,5,30,200, "97")
+
+smlua_text_utils_dialog_replace(DIALOG_098,1,2,95,200, "98")
+
+smlua_text_utils_dialog_replace(DIALOG_099,1,5,95,200, "99")
+
+smlua_text_utils_dialog_replace(DIALOG_100,1,3,95,200, "100")
+
+smlua_text_utils_dialog_replace(DIALOG_101,1,3,95,200, "101")
+
+smlua_text_utils_dialog_replace(DIALOG_102,1,5,30,200, "102")
+
+smlua_text_utils_dialog_replace(DIALOG_103,1,4,95,200, "103")
+
+smlua_text_utils_dialog_replace(DIALOG_104,1,5,30,200, "104")
+
+smlua_text_utils_dialog_replace(DIALOG_105,1,3,95,200, "105")
+
+smlua_text_utils_dialog_replace(DIALOG_106,1,2,95,200, "The cannon opening ritual\
+is now complete.")
+
+smlua_text_utils_dialog_replace(DIALOG_107,1,3,95,200, "107")
+
+smlua_text_utils_dialog_replace(DIALOG_108,1,2,95,200, "108")
+
+smlua_text_utils_dialog_replace(DIALOG_109,1,4,95,200, "109")
+
+smlua_text_utils_dialog_replace(DIALOG_110,1,5,95,200, "110")
+
+smlua_text_utils_dialog_replace(DIALOG_111,1,4,95,200, "111")
+
+smlua_text_utils_dialog_replace(DIALOG_112,1,4,30,200, "112")
+
+smlua_text_utils_dialog_replace(DIALOG_113,1,6,30,200, "113")
+
+smlua_text_utils_dialog_replace(DIALOG_114,1,5,95,200, "How the hell did I\
+get here?\
+Can anyone explain that?\
+I woke up today and was\
+on this bloody pillar!\
+That makes me so angry!\
+And that's why I will\
+attack you now.")
+
+smlua_text_utils_dialog_replace(DIALOG_115,1,5,95,200, "What a crappy day.\
+That could only happen\
+to me...")
+
+smlua_text_utils_dialog_replace(DIALOG_116,1,5,95,200, "THAT CAN'T BE!!!\
+I will give that stuff\
+back to the store and\
+demand refunds!")
+
+smlua_text_utils_dialog_replace(DIALOG_117,1,1,95,200, "117")
+
+smlua_text_utils_dialog_replace(DIALOG_118,1,6,95,200, "118")
+
+smlua_text_utils_dialog_replace(DIALOG_119,1,6,30,200, "Oh no... I landed on my\
+back again... but...\
+there's the switch\
+for the...\
+WHAT THE FU...BOOOOOOOM!")
+
+smlua_text_utils_dialog_replace(DIALOG_120,1,4,30,200, "Ouch!\
+...let's go to the\
+chiropractor!\
+\
+...ah crap, I just lost\
+all my money in NSMB2.\
+Looks like I have to\
+be nice and ask Kamek\
+whether he can bring\
+me the first aid kit\
+from the cellar.\
+What a dishonor...\
+I will pay that back,\
+Mario!")
+
+smlua_text_utils_dialog_replace(DIALOG_121,1,5,30,200, "I think nobody should\
+ever read this text.\
+If you are reading\
+this PLAY THE GAME\
+WITHOUT CHEATING YOU\
+LOSER!!!")
+
+smlua_text_utils_dialog_replace(DIALOG_122,1,4,30,200, "122")
+
+smlua_text_utils_dialog_replace(DIALOG_123,1,4,30,200, "123")
+
+smlua_text_utils_dialog_replace(DIALOG_124,1,4,30,200, "124")
+
+smlua_text_utils_dialog_replace(DIALOG_125,1,3,30,200, "125")
+
+smlua_text_utils_dialog_replace(DIALOG_126,2,3,30,200, "126")
+
+smlua_text_utils_dialog_replace(DIALOG_127,3,4,30,200, "127")
+
+smlua_text_utils_dialog_replace(DIALOG_128,1,4,95,200, "Are you stupid or what?\
+You should know that\
+throwing me down there\
+doesn't get you anywhere.")
+
+smlua_text_utils_dialog_replace(DIALOG_129,1,5,30,200, "129")
+
+smlua_text_utils_dialog_replace(DIALOG_130,1,5,30,200, "130")
+
+smlua_text_utils_dialog_replace(DIALOG_131,1,5,30,200, "131")
+
+smlua_text_utils_dialog_replace(DIALOG_132,1,4,30,200, "132")
+
+smlua_text_utils_dialog_replace(DIALOG_133,1,6,30,200, "133")
+
+smlua_text_utils_dialog_replace(DIALOG_134,1,5,30,200, "134")
+
+smlua_text_utils_dialog_replace(DIALOG_135,1,5,30,200, "135")
+
+smlua_text_utils_dialog_replace(DIALOG_136,1,6,30,200, "136")
+
+smlua_text_utils_dialog_replace(DIALOG_137,1,6,30,200, "137")
+
+smlua_text_utils_dialog_replace(DIALOG_138,1,3,30,200, "138")
+
+smlua_text_utils_dialog_replace(DIALOG_139,1,6,30,200, "139")
+
+smlua_text_utils_dialog_replace(DIALOG_140,1,6,30,200, "140")
+
+smlua_text_utils_dialog_replace(DIALOG_141,1,5,150,200, "You got the first star.\
+But seriously:\
+That's nothing to\
+be proud of.")
+
+smlua_text_utils_dialog_replace(DIALOG_142,1,5,150,200, "Three stars aren't\
+much either. Nothing\
+worth mentioning.")
+
+smlua_text_utils_dialog_replace(DIALOG_143,1,6,150,200, "Do you know what\
+you are trying to do?\
+You are still at the\
+very beginning.\
+But I know that you are\
+already sweating.\
+...not just because\
+here's so much lava.")
+
+smlua_text_utils_dialog_replace(DIALOG_144,1,6,150,200, "So you got 30 stars...\
+I bet you already had\
+a lot of problems to get\
+this far but I can promise\
+that it will be much much\
+worse :P")
+
+smlua_text_utils_dialog_replace(DIALOG_145,1,6,150,200, "50... may sound like much\
+but it isn't much.\
+I will have much more\
+fun watching you get\
+frustrated at the much\
+more difficult tasks.\
+MWAHAHAHA!")
+
+smlua_text_utils_dialog_replace(DIALOG_146,1,6,150,200, "You got half the stars\
+and needed so much effort.\
+But well, it's only the\
+first half.\
+Although this is the last\
+star message you'll get\
+you should know that\
+your goal is incredibly\
+far away.\
+Soon you can open the\
+first of the final star\
+doors and experience the\
+true cruelties.\
+Even in case you didn't\
+have much trouble getting\
+here (and I doubt that)\
+I can tell you that\
+these last levels demand\
+a lot of frustration\
+resistance. Are you\
+prepared for these\
+extreme challenges?\
+MWAHAHAHAHA!!!!")
+
+smlua_text_utils_dialog_replace(DIALOG_147,1,5,30,200, "147")
+
+smlua_text_utils_dialog_replace(DIALOG_148,1,6,30,200, "148")
+
+smlua_text_utils_dialog_replace(DIALOG_149,1,3,30,200, "149")
+
+smlua_text_utils_dialog_replace(DIALOG_150,1,5,30,200, "150")
+
+smlua_text_utils_dialog_replace(DIALOG_151,1,4,30,200, "151")
+
+smlua_text_utils_dialog_replace(DIALOG_152,1,3,30,200, "152")
+
+smlua_text_utils_dialog_replace(DIALOG_153,1,4,30,200, "153")
+
+smlua_text_utils_dialog_replace(DIALOG_154,1,5,30,200, "Why I am standing here?\
+I want to be alone.\
+The other Toads are\
+crying all the time.\
+'Oh, I have this problem'\
+'Oh, I have that problem'\
+It's sooo annoying.\
+How did I even get here?")
+
+smlua_text_utils_dialog_replace(DIALOG_155,1,6,30,200, "You can tell me what\
+you want, I won't\
+leave this hideout.\
+It's the safest spot\
+I have seen in weeks.\
+If you are such a\
+coward and run away \
+instead of fighting \
+Bowser search for your\
+own shelter.")
+
+smlua_text_utils_dialog_replace(DIALOG_156,1,5,30,200, "I'll just wait here\
+until you get an idea\
+how I can be safed, okay?\
+You will help me, right?\
+You know...it's pretty\
+lonely here and I'd like\
+to see my family again.\
+...good luck finding\
+a rescue method.")
+
+smlua_text_utils_dialog_replace(DIALOG_157,1,5,30,200, "157")
+
+smlua_text_utils_dialog_replace(DIALOG_158,1,6,30,200, "158")
+
+smlua_text_utils_dialog_replace(DIALOG_159,1,6,30,200, "159")
+
+smlua_text_utils_dialog_replace(DIALOG_160,1,4,30,200, "160")
+
+smlua_text_utils_dialog_replace(DIALOG_161,1,4,30,200, "Yoshuar")
+
+smlua_text_utils_dialog_replace(DIALOG_162,1,4,30,200, "Another rabbit!\
+Nice, the Toads only\
+had rocks to eat the\
+past days. That will make\
+them happy. Here's your\
+price.")
+
+smlua_text_utils_dialog_replace(DIALOG_163,1,5,30,200, "I give up.\
+It seems like there is\
+absolutely no chance for\
+me to win. Even such \
+unfair obstacles can't\
+stop you.\
+As much as I hate you -\
+I have to say:\
+You are extremely\
+addicted to gaming.\
+...I mean you are a good\
+player.\
+Well, in this case, you\
+really are an addict.\
+The maker of this hack is\
+also an addict like you\
+cause he had to test this\
+crap. And if you still\
+don't have enough, there\
+is still the 150-star-\
+grill that needs to be\
+opened. Even those who\
+beat me will have trouble\
+doing that.\
+Other than that...\
+have fun with the credits.\
+I inserted a little gag,\
+hehe.\
+(Actually it's a bug but\
+I thought it was funny\
+so I kept it in the game)")
+
+smlua_text_utils_dialog_replace(DIALOG_164,1,4,30,200, "Mario! What's up, pal?\
+I haven't been on the\
+slide lately, so I'm out\
+of shape.\
+Still, I'm always up for a\
+good race, especially\
+against an old sleddin'\
+buddy.\
+Whaddya say?\
+Ready...set...\
+\
+//Go//// Don't Go")
+
+-- weird
+smlua_text_utils_dialog_replace(DIALOG_165,1,5,30,200, "165")
+
+smlua_text_utils_dialog_replace(DIALOG_166,1,4,30,200, "166")
+
+smlua_text_utils_dialog_replace(DIALOG_167,1,4,30,200, "167")
+
+smlua_text_utils_dialog_replace(DIALOG_168,1,5,30,200, "168")
+
+smlua_text_utils_dialog_replace(DIALOG_169,1,4,30,200, "169")
+end
+
+----------
+-- main --
+----------
+
+function dialog_swap()
+    local areaIndex = gNetworkPlayers[0].currAreaIndex
+    if areaIndex == 1 then
+        dialog_swap_sm74()
+        sDialogsEE = false
+    else
+        dialog_swap_sm74ee()
+        sDialogsEE = true
+    end
+end
+
+-----------
+-- setup --
+-----------
+
+-- do initial swap to sm74
+sDialogsEE = true
+dialog_swap_sm74()
+sDialogsEE = false